@@ -0,0 +1,48 @@
+#include "allocation_stats.hpp"
+
+#include <stdlib.h>
+
+#include <new>
+
+using namespace std;
+
+#ifdef COUNT_ALLOCATIONS
+
+/*
+ * Counter is per thread, so the allocations of the worker don't get counted
+ * in the frames that main thread renders.
+ */
+thread_local size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+  allocationCount++;
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == NULL) {
+    throw bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  free(ptr);
+}
+
+bool AllocationStats::enabled() {
+  return true;
+}
+
+size_t AllocationStats::getCount() {
+  return allocationCount;
+}
+
+#else
+
+bool AllocationStats::enabled() {
+  return false;
+}
+
+size_t AllocationStats::getCount() {
+  return 0;
+}
+
+#endif
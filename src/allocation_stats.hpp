@@ -0,0 +1,20 @@
+#ifndef ALLOCATION_STATS_H
+#define ALLOCATION_STATS_H
+
+#include <stddef.h>
+
+using namespace std;
+
+/*
+ * Number of heap allocations made by the calling thread. They only get
+ * counted if the program was built with 'make bench' (that defines
+ * COUNT_ALLOCATIONS and replaces the global operator new), so other builds
+ * don't pay for it.
+ */
+class AllocationStats {
+  public:
+    static bool enabled();
+    static size_t getCount();
+};
+
+#endif
@@ -7,9 +7,12 @@
 #include <string>
 #include <vector>
 
+#include "debugger.hpp"
+#include "fast_cpu.hpp"
 #include "parser.hpp"
 #include "interactive_mode.hpp"
 #include "noninteractive_mode.hpp"
+#include "startup_stats.hpp"
 #include "util.hpp"
 
 using namespace std;
@@ -17,6 +20,7 @@ using namespace std;
 void assertFilenames();
 bool inputIsNotPiped();
 void processArguments(int argc, const char* argv[]);
+string getOptionValue(int argc, const char* argv[], int i);
 void processFilename(string filename);
 string getFilenameOut();
 void saveSourceToFile(string filenameOut);
@@ -32,11 +36,17 @@ bool inputChars = false;
 bool rawInput = false;
 bool compile = false;
 bool parse = false;
+bool threads = false;
+bool stats = false;
+bool startupStats = false;
+bool renderBenchmark = false;
+string keysToRecord;
+string keysToReplay;
 
 int main(int argc, const char* argv[]) {
   srand(time(NULL));
   processArguments(argc, argv);
-  if (interactivieMode == true) {
+  if (interactivieMode == true && keysToReplay.empty()) {
     interactivieMode = inputIsNotPiped();
   }
   if (outputChars == false) {
@@ -47,7 +57,8 @@ int main(int argc, const char* argv[]) {
     string filenameOut = getFilenameOut();
     string sourceNameOut = "/tmp/"+filenameOut+".cpp";
     saveSourceToFile(sourceNameOut);
-    string command = GCC_COMMAND+" "+filenameOut+" "+sourceNameOut;
+    string gccCommand = threads ? GCC_THREADS_COMMAND : GCC_COMMAND;
+    string command = gccCommand+" "+filenameOut+" "+sourceNameOut;
     int statusCode = system(command.c_str());
     if (statusCode == 0) {
       cout << "Compiled as " + filenameOut << endl;
@@ -57,10 +68,25 @@ int main(int argc, const char* argv[]) {
     string filenameOut = getFilenameOut();
     saveSourceToFile(filenameOut+".cpp");
     cout << "Source saved to " + filenameOut + ".cpp" << endl;
+  } else if (renderBenchmark) {
+    assertFilenames();
+    InteractiveMode::runRenderBenchmark(filenames[0]);
   } else if (interactivieMode) {
+    if (!keysToRecord.empty()) {
+      InteractiveMode::recordKeys(keysToRecord);
+    }
+    if (!keysToReplay.empty()) {
+      InteractiveMode::replayKeys(keysToReplay);
+    }
     InteractiveMode::startInteractiveMode(getFirstFilename());
   } else {
     assertFilenames();
+    if (stats) {
+      FastCpu::enableFusionStats();
+    }
+    if (startupStats) {
+      atexit(StartupStats::printStats);
+    }
     NoninteractiveMode mode = NoninteractiveMode(filenames, outputNumbers,
                                                  outputChars, inputChars, 
                                                  rawInput);
@@ -103,12 +129,43 @@ void processArguments(int argc, const char* argv[]) {
       compile = true;
     } else if (Util::contains({ "parse" }, arg)) {
       parse = true;
+    } else if (Util::contains({ "render-bench" }, arg)) {
+      renderBenchmark = true;
+    } else if (Util::contains({ "--record-keys" }, arg)) {
+      keysToRecord = getOptionValue(argc, argv, i++);
+    } else if (Util::contains({ "--replay-keys" }, arg)) {
+      keysToReplay = getOptionValue(argc, argv, i++);
+    } else if (Util::contains({ "--break" }, arg)) {
+      interactivieMode = false;
+      Debugger::addBreakpoint(getOptionValue(argc, argv, i++));
+    } else if (Util::contains({ "--watch" }, arg)) {
+      interactivieMode = false;
+      Debugger::addWatchpoint(getOptionValue(argc, argv, i++));
+    } else if (Util::contains({ "--threads" }, arg)) {
+      threads = true;
+    } else if (Util::contains({ "--stats" }, arg)) {
+      interactivieMode = false;
+      stats = true;
+    } else if (Util::contains({ "--startup-stats" }, arg)) {
+      interactivieMode = false;
+      startupStats = true;
     } else {
       processFilename(argv[i]);
     }
   }
 }
 
+/*
+ * Returns the argument that follows the option at index i.
+ */
+string getOptionValue(int argc, const char* argv[], int i) {
+  if (i + 1 >= argc) {
+    cout << "Option " << argv[i] << " requires a value. Aborting.";
+    exit(1);
+  }
+  return argv[i + 1];
+}
+
 void processFilename(string filename) {
   if (Util::isADir(filename)) {
     dirname = filename;
@@ -155,7 +212,8 @@ string getFilenameOut() {
 }
 
 void saveSourceToFile(string filenameOut) {
-  string source = Parser::parse(filenames, outputChars, inputChars, rawInput);
+  string source = Parser::parse(filenames, outputChars, inputChars, rawInput,
+                                threads);
   ofstream out(filenameOut);
   out << source;
   out.close();
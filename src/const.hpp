@@ -7,8 +7,24 @@
 
 using namespace std;
 
-// Miliseconds between cycles (when run in interactive mode).
-const int FQ = 333;
+// Clock speeds in Hz, that can be selected with '<' and '>' keys in
+// interactive mode. Zero stands for unbounded speed (turbo). Screen gets
+// redrawn at most FRAME_RATE times per second.
+const vector<int> CLOCK_SPEEDS = { 1, 3, 10, 30, 100, 1000, 10000, 100000,
+                                   0 };
+const int DEFAULT_CLOCK_SPEED_INDEX = 1;
+const int FRAME_RATE = 30;
+// Frame gets skipped if terminal hasn't yet printed this many bytes of the
+// previous ones, or if writing the last frame took longer than half of the
+// frame period. Indicator is shown for a second after a skipped frame.
+const int MAX_PENDING_OUTPUT = 4096;
+const string FRAMES_SKIPPED_INDICATOR = " SLOW TERMINAL, SKIPPED FRAMES: ";
+// Number of cycles of the program that render benchmark draws in each view
+// (a frame per cycle). Random input gets seeded with BENCHMARK_SEED when
+// benchmarking, and when recording or replaying keys, so the executions
+// can be repeated.
+const int RENDER_BENCHMARK_CYCLES = 1000;
+const int BENCHMARK_SEED = 0;
 
 const string SAVE_FILE_NAME = "punchcard-";
 const string FILE_EXTENSION = "cm2";
@@ -25,6 +41,28 @@ const int AND_OPERAND_INDEX = 2;
 const int OR_OPERAND_INDEX = 3;
 
 const string GCC_COMMAND = "g++ -std=c++11 -g -O2 -o";
+const string GCC_THREADS_COMMAND = "g++ -std=c++11 -g -O2 -pthread -o";
+const string NATIVE_GCC_COMMAND = "g++ -std=c++11 -O2 -pipe -shared -fPIC -o";
+
+// Maximum number of cycles and output words that get precomputed before
+// the first read from the input.
+const int PARTIAL_EVALUATION_CYCLES = 100000;
+const int PARTIAL_EVALUATION_OUTPUTS = 4096;
+
+// Number of cycles after which program gets moved from the reference cpu to
+// the fast cpu, and after which it gets compiled to native code (when run in
+// non-interactive mode). Fast cpu checks if native code is ready every
+// FAST_TIER_SLICE cycles.
+const int FAST_TIER_CYCLES = 1000;
+const long NATIVE_TIER_CYCLES = 50000000;
+const long FAST_TIER_SLICE = 1000000;
+
+// Number of last cycles that paused execution can be stepped back through
+// in interactive mode, and in debugger. Whole state gets saved every
+// EXECUTION_LOG_KEYFRAME_INTERVAL cycles, so a step back never needs to undo
+// more cycles than that.
+const int EXECUTION_LOG_CYCLES = 1 << 20;
+const int EXECUTION_LOG_KEYFRAME_INTERVAL = 1024;
 
 const bool BRIGHTEN_CURSOR = false;
 const bool BRIGHTEN_LIGHTBULBS = false;
@@ -53,6 +91,8 @@ const vector<bool> LAST_XOR_INSTRUCTION = { false, true, true, true, true, true,
 const int LAST_XOR_OPERAND_INDEX = 7;                                  
 
 const int PRINTER_WIDTH = 12;
+// Number of lines that printer remembers, and that can be scrolled through.
+const size_t PRINTER_HISTORY = 1000;
 
 const string LOGIC_OPS_INDICATOR = "JRI~<>&VX";
 const int LOGIC_OPS_INDEX = 7;
@@ -67,12 +107,10 @@ const string LAST_DATA_ADDR_LABEL = " IN/OUT ";
 
 const string HIGHLIGHT_ESC = "\e[7m";
 const string HIGHLIGHT_END_ESC = "\e[27m";
-
-const vector<string> HIGHLIGHT_ESC_VEC = { "\e", "[", "7", "m" };
-const vector<string> HIGHLIGHT_END_ESC_VEC = { "\e", "[", "2", "7", "m" };
-
-const vector<string> BRIGHT_ESC_VEC = { "\e", "[", "9", "7", "m" };
-const vector<string> BRIGHT_END_ESC_VEC = { "\e", "[", "3", "7", "m" };
+const string BRIGHT_ESC = "\e[97m";
+const string BRIGHT_END_ESC = "\e[37m";
+// Colors of the lightbulbs by heat level. First one is the default color.
+const vector<string> HEAT_ESC = { "\e[37m", "\e[36m", "\e[33m", "\e[31m" };
 
 const string CODE_INDICATOR = "a";
 const string DATA_INDICATOR = "b";
@@ -83,10 +121,13 @@ const set<string> LIGHTBULB_INDICATORS = { CODE_INDICATOR, DATA_INDICATOR, CODE_
                              DATA_ADR_INDICATOR, REGISTER_INDICATOR };
 
 const string OUTPUT_INDICATOR = "o";
+const string CODE_HEAT_INDICATOR = "c";
+const string DATA_HEAT_INDICATOR = "d";
+// Longest heat counter that gets formatted, enough for any size_t.
+const size_t MAX_COUNT_WIDTH = 24;
 
 const string NEW_LINE_FIRST = u8"\u000D";
 const string NEW_LINE_SECOND = u8"\u000A";
-const string ESCAPE = u8"\u001B";
 const string LOWERCASE_M = u8"\u006D";
 
 const string SOURCE_INCLUDES= ""
@@ -188,12 +229,19 @@ const string PRINT_RAW = ""
 "  fflush(stdout);\n"
 "}";
 
+// Gets called by f0() when there is no more input.
+const string END_OF_INPUT = ""
+"void endOfInput(const char *tail) {\n"
+"  cout << tail;\n"
+"  exit(0);\n"
+"}";
+
 const string F0_BASIC = ""
 "unsigned char f0() {\n"
 "  string word;\n"
 "  cin >> word;\n"
 "  if (!cin) {\n"
-"    exit(0);\n"
+"    endOfInput(\"\");\n"
 "  }\n"
 "  return parseWord(word);\n"
 "}";
@@ -202,8 +250,7 @@ const string F0_INPUT_CHARS = ""
 "unsigned char f0() {\n"
 "  int c = getchar();\n"
 "  if (c == EOF) {\n"
-"    cout << endl;\n"
-"    exit(0);\n"
+"    endOfInput(\"\\n\");\n"
 "  }\n"
 "  return (unsigned char) c;\n"
 "}";
@@ -243,23 +290,267 @@ const string SOURCE_FOOTER_2 = "());\n"
 const string SOURCE_FUNCTION_HEADER_1 = "unsigned char f";
 
 const string SOURCE_FUNCTION_HEADER_2 = "() {\n"
-"  static unsigned char (*predecesor)() = &f";
+"  static unsigned char (*predecesor)() = &";
 
 const string SOURCE_FUNCTION_HEADER_3 = ";\n"
 "  static void *a[16] = { &&a00, &&a01, &&a02, &&a03, &&a04, &&a05,\n"
 "                              &&a06, &&a07, &&a08, &&a09, &&a10, &&a11,\n" 
 "                              &&a12, &&a13, &&a14, &&a15 };\n"
-"  static unsigned char reg = 0;\n"
-"  static unsigned char pc = 0;\n"
+"  static unsigned char reg = ";
+
+const string SOURCE_FUNCTION_HEADER_4 = ";\n"
+"  static unsigned char pc = ";
+
+const string SOURCE_FUNCTION_HEADER_5 = ";\n"
 "  static unsigned char adr = 0;\n"
 "  static unsigned char data[15] = { ";
 
-const string SOURCE_FUNCTION_HEADER_4 = " };\n"
-"\n"
+const string SOURCE_FUNCTION_HEADER_6 = " };\n";
+
+// Output of the partially evaluated part of the program, that gets
+// returned before execution continues.
+const string SOURCE_FUNCTION_PREFIX_1 = ""
+"  static const unsigned char prefix[] = { ";
+
+const string SOURCE_FUNCTION_PREFIX_2 = " };\n"
+"  static size_t prefixIndex = 0;\n"
+"  if (prefixIndex < sizeof(prefix)) {\n"
+"    return prefix[prefixIndex++];\n"
+"  }\n";
+
+const string SOURCE_FUNCTION_START = "\n"
 "  goto *a[pc];";
 
 const string SOURCE_FUNCTION_FOOTER = ""
 "  a15: exit(0);\n"
 "}";
 
+// Function that gets compiled into a shared library by the native tier of
+// the non-interactive mode. It continues from the passed state and returns
+// next output, or -1 when last address is reached.
+const string NATIVE_STAGE_HEADER = ""
+"extern \"C\" int stage(unsigned char (*input)(void *), void *context,\n"
+"                       unsigned char *data, unsigned char &reg,\n"
+"                       unsigned char &pc) {\n"
+"  static void *a[16] = { &&a00, &&a01, &&a02, &&a03, &&a04, &&a05,\n"
+"                         &&a06, &&a07, &&a08, &&a09, &&a10, &&a11,\n"
+"                         &&a12, &&a13, &&a14, &&a15 };\n"
+"  auto predecesor = [&]() { return input(context); };\n"
+"  unsigned char adr = 0;\n"
+"\n"
+"  goto *a[pc];";
+
+const string NATIVE_STAGE_FOOTER = ""
+"  a15: return -1;\n"
+"}";
+
+/////////////////////////////
+/// THREADED CHAIN SOURCE ///
+/////////////////////////////
+
+// Each computer of the chain runs in its own thread. Computers are connected
+// with lock-free single-producer/single-consumer rings. Ring 'n' holds the
+// output of function 'fn', and f0 is the input reader.
+
+const string SOURCE_THREADS_INCLUDES = ""
+"#include <pthread.h>\n"
+"#include <sched.h>\n"
+"#include <signal.h>\n"
+"#include <string.h>\n"
+"\n"
+"#include <atomic>\n"
+"#include <chrono>\n"
+"#include <thread>\n"
+"#include <vector>";
+
+const string SOURCE_THREADS_RUNTIME = ""
+"const size_t DEFAULT_RING_SIZE = 4096;\n"
+"\n"
+"// Thrown when a stage has no more input, or when it reaches the last\n"
+"// address. Holds the string that gets printed after the last output.\n"
+"struct StageEnd {\n"
+"  const char *tail;\n"
+"};\n"
+"\n"
+"void backoff(int &spins) {\n"
+"  if (++spins < 64) {\n"
+"    this_thread::yield();\n"
+"  } else {\n"
+"    this_thread::sleep_for(chrono::microseconds(20));\n"
+"  }\n"
+"}\n"
+"\n"
+"class Ring {\n"
+"  public:\n"
+"    void init(size_t sizeIn) {\n"
+"      size = sizeIn;\n"
+"      buffer = new unsigned char[size];\n"
+"    }\n"
+"\n"
+"    void push(unsigned char c) {\n"
+"      size_t t = tail.load(memory_order_relaxed);\n"
+"      int spins = 0;\n"
+"      while (t - head.load(memory_order_acquire) == size) {\n"
+"        backoff(spins);\n"
+"      }\n"
+"      buffer[t & (size-1)] = c;\n"
+"      tail.store(t+1, memory_order_release);\n"
+"    }\n"
+"\n"
+"    unsigned char pop() {\n"
+"      size_t h = head.load(memory_order_relaxed);\n"
+"      int spins = 0;\n"
+"      while (h == tail.load(memory_order_acquire)) {\n"
+"        if (closed.load(memory_order_acquire) &&\n"
+"            h == tail.load(memory_order_acquire)) {\n"
+"          throw StageEnd { endTail };\n"
+"        }\n"
+"        backoff(spins);\n"
+"      }\n"
+"      unsigned char c = buffer[h & (size-1)];\n"
+"      head.store(h+1, memory_order_release);\n"
+"      return c;\n"
+"    }\n"
+"\n"
+"    void close(const char *tailIn) {\n"
+"      endTail = tailIn;\n"
+"      closed.store(true, memory_order_release);\n"
+"    }\n"
+"\n"
+"  private:\n"
+"    unsigned char *buffer = NULL;\n"
+"    size_t size = 0;\n"
+"    const char *endTail = \"\";\n"
+"    alignas(64) atomic<size_t> head { 0 };\n"
+"    alignas(64) atomic<size_t> tail { 0 };\n"
+"    atomic<bool> closed { false };\n"
+"};\n"
+"\n"
+"Ring *rings = NULL;\n"
+"\n"
+"template<int N> unsigned char pop() {\n"
+"  return rings[N].pop();\n"
+"}\n"
+"\n"
+"void endOfInput(const char *tail) {\n"
+"  throw StageEnd { tail };\n"
+"}\n"
+"\n"
+"void runStage(unsigned char (*stage)(), int index) {\n"
+"  // Only input reader gets interrupted by ctrl-c.\n"
+"  if (index == 0) {\n"
+"    sigset_t set;\n"
+"    sigemptyset(&set);\n"
+"    sigaddset(&set, SIGINT);\n"
+"    pthread_sigmask(SIG_UNBLOCK, &set, NULL);\n"
+"  }\n"
+"  try {\n"
+"    while (1) {\n"
+"      rings[index].push(stage());\n"
+"    }\n"
+"  } catch (StageEnd &end) {\n"
+"    rings[index].close(end.tail);\n"
+"  }\n"
+"}\n"
+"\n"
+"size_t getRingSize(const char *arg) {\n"
+"  size_t requested = strtoul(arg, NULL, 10);\n"
+"  size_t size = 1;\n"
+"  while (size < requested) {\n"
+"    size <<= 1;\n"
+"  }\n"
+"  return size;\n"
+"}\n"
+"\n"
+"vector<int> getCpus(const char *arg) {\n"
+"  vector<int> cpus;\n"
+"  const char *start = arg;\n"
+"  while (1) {\n"
+"    char *end;\n"
+"    long cpu = strtol(start, &end, 10);\n"
+"    bool valid = end != start && (*end == ',' || *end == '\\0') &&\n"
+"                 cpu >= 0 && cpu < CPU_SETSIZE;\n"
+"    if (!valid) {\n"
+"      fprintf(stderr, \"Invalid list of cpus '%s', use comma separated \"\n"
+"              \"numbers smaller than %d. Aborting.\\n\", arg, CPU_SETSIZE);\n"
+"      exit(1);\n"
+"    }\n"
+"    cpus.push_back(cpu);\n"
+"    if (*end == '\\0') {\n"
+"      return cpus;\n"
+"    }\n"
+"    start = end + 1;\n"
+"  }\n"
+"}\n"
+"\n"
+"void pinThread(pthread_t thread, const vector<int> &cpus, int index) {\n"
+"  if (cpus.empty()) {\n"
+"    return;\n"
+"  }\n"
+"  cpu_set_t set;\n"
+"  CPU_ZERO(&set);\n"
+"  CPU_SET(cpus[index % cpus.size()], &set);\n"
+"  pthread_setaffinity_np(thread, sizeof(cpu_set_t), &set);\n"
+"}\n"
+"\n"
+"/*\n"
+" * Options: '--ring-size <bytes>' sets capacity of rings between the stages,\n"
+" * and '--cpus <list>' pins n-th thread (input reader is first, printer\n"
+" * last) to the n-th cpu of the comma separated list.\n"
+" */\n"
+"void runChain(int argc, char *argv[], unsigned char (*stages[])(),\n"
+"              int numOfStages) {\n"
+"  size_t ringSize = DEFAULT_RING_SIZE;\n"
+"  vector<int> cpus;\n"
+"  for (int i = 1; i < argc-1; i++) {\n"
+"    if (strcmp(argv[i], \"--ring-size\") == 0) {\n"
+"      ringSize = getRingSize(argv[++i]);\n"
+"    } else if (strcmp(argv[i], \"--cpus\") == 0) {\n"
+"      cpus = getCpus(argv[++i]);\n"
+"    }\n"
+"  }\n"
+"  rings = new Ring[numOfStages];\n"
+"  for (int i = 0; i < numOfStages; i++) {\n"
+"    rings[i].init(ringSize);\n"
+"  }\n"
+"  // Threads inherit the mask, runStage unblocks it for the input reader.\n"
+"  sigset_t set;\n"
+"  sigemptyset(&set);\n"
+"  sigaddset(&set, SIGINT);\n"
+"  pthread_sigmask(SIG_BLOCK, &set, NULL);\n"
+"  for (int i = 0; i < numOfStages; i++) {\n"
+"    thread stageThread(runStage, stages[i], i);\n"
+"    pinThread(stageThread.native_handle(), cpus, i);\n"
+"    stageThread.detach();\n"
+"  }\n"
+"  pinThread(pthread_self(), cpus, numOfStages);\n"
+"  try {\n"
+"    while (1) {\n"
+"      print(rings[numOfStages-1].pop());\n"
+"    }\n"
+"  } catch (StageEnd &end) {\n"
+"    cout << end.tail;\n"
+"    exit(0);\n"
+"  }\n"
+"}";
+
+const string SOURCE_THREADS_FOOTER_1 = ""
+"int main(int argc, char *argv[]) {\n"
+"  outputNumbers = isatty(fileno(stdout));\n"
+"  unsigned char (*stages[])() = { ";
+
+const string SOURCE_THREADS_FOOTER_1_RAW = ""
+"int main(int argc, char *argv[]) {\n"
+"  setEnvironment();\n"
+"  outputNumbers = isatty(fileno(stdout));\n"
+"  unsigned char (*stages[])() = { ";
+
+const string SOURCE_THREADS_FOOTER_2 = " };\n"
+"  runChain(argc, argv, stages, sizeof(stages)/sizeof(stages[0]));\n"
+"}";
+
+const string SOURCE_FUNCTION_FOOTER_THREADS = ""
+"  a15: throw StageEnd { \"\" };\n"
+"}";
+
 #endif
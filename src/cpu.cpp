@@ -6,7 +6,9 @@
 #include <set>
 
 #include "address.hpp"
+#include "execution_log.hpp"
 #include "instruction.hpp"
+#include "ram.hpp"
 #include "util.hpp"
 
 using namespace std;
@@ -21,10 +23,59 @@ bool Cpu::step() {
     return false;
   }
   Instruction inst = getInstruction();
+  countAccesses(inst);
+  if (log != NULL) {
+    recordCycle();
+  }
   inst.exec(pc, reg, ram);
+  if (log != NULL) {
+    recordChanges(inst);
+  }
   return true;
 }
 
+/*
+ * Counts are kept here and not in the ram, because ram also gets read by
+ * the renderer and the editor.
+ */
+void Cpu::countAccesses(const Instruction &inst) {
+  codeHeat[Util::getInt(pc)]++;
+  if (inst.adr.space != DATA) {
+    return;
+  }
+  int adr = Util::getInt(inst.adr.val);
+  if (adr < RAM_SIZE) {
+    dataHeat[adr]++;
+  }
+}
+
+/*
+ * Whole data only gets packed when the log starts, after that each cycle
+ * only reports the word it wrote.
+ */
+void Cpu::recordCycle() {
+  if (!log->needsData(cycle - 1)) {
+    log->record(cycle - 1, Util::getInt(pc), Util::getInt(reg), NULL);
+    return;
+  }
+  RamImage image = ram.getImage();
+  log->record(cycle - 1, Util::getInt(pc), Util::getInt(reg),
+              &image[DATA * RAM_SIZE]);
+}
+
+void Cpu::recordChanges(const Instruction &inst) {
+  Opcode opcode = inst.decoded.opcode;
+  bool writes = opcode == WRITE || opcode == INIT || opcode == INCREASE ||
+                opcode == DECREASE || opcode == WRITE_POINTER;
+  int adr = Util::getInt(inst.adr.val);
+  if (writes && inst.adr.space == DATA && adr < RAM_SIZE) {
+    log->recordWrite(adr, Util::getInt(ram.get(inst.adr)));
+  }
+  if (ram.outputPending) {
+    log->recordOutput();
+  }
+}
+
 void Cpu::reset() {
   reg = vector<bool>(WORD_SIZE);
   pc = vector<bool>(ADDR_SIZE);
@@ -37,20 +88,47 @@ Instruction Cpu::getInstruction() const {
   return Instruction(instructionWord, reg, &ram);
 }
 
-vector<bool> Cpu::getRegister() const {
+const vector<bool> &Cpu::getRegister() const {
   return reg;
 }
 
-vector<bool> Cpu::getPc() const {
+const vector<bool> &Cpu::getPc() const {
   return pc;
 }
 
+void Cpu::setRegister(const vector<bool> &regIn) {
+  reg = regIn;
+}
+
+void Cpu::setPc(const vector<bool> &pcIn) {
+  pc = pcIn;
+}
+
+void Cpu::setCycle(int cycleIn) {
+  cycle = cycleIn;
+}
+
 int Cpu::getCycle() const {
   return cycle;
 }
 
 void Cpu::switchOn() {
   cycle = 1;
+  codeHeat = vector<size_t>(RAM_SIZE);
+  dataHeat = vector<size_t>(RAM_SIZE);
+}
+
+const vector<size_t> &Cpu::getHeat(AddrSpace space) const {
+  return space == CODE ? codeHeat : dataHeat;
+}
+
+void Cpu::copyHeat(const Cpu &other) {
+  codeHeat = other.codeHeat;
+  dataHeat = other.dataHeat;
+}
+
+void Cpu::setLog(ExecutionLog *logIn) {
+  log = logIn;
 }
 
 
@@ -3,11 +3,13 @@
 
 #include <vector>
 
+#include "addr_space.hpp"
 #include "const.hpp"
 #include "ram.hpp"
 
 using namespace std;
 
+class ExecutionLog;
 class Instruction;
 
 class Cpu {
@@ -17,16 +19,31 @@ class Cpu {
     bool step();
     void reset();
     Instruction getInstruction() const;
-    vector<bool> getRegister() const;
-    vector<bool> getPc() const;
+    const vector<bool> &getRegister() const;
+    const vector<bool> &getPc() const;
+    void setRegister(const vector<bool> &regIn);
+    void setPc(const vector<bool> &pcIn);
+    void setCycle(int cycleIn);
     int getCycle() const;
     void switchOn();
+    const vector<size_t> &getHeat(AddrSpace space) const;
+    void copyHeat(const Cpu &other);
+    void setLog(ExecutionLog *logIn);
 
   private:
     Ram &ram;
     vector<bool> reg = vector<bool>(WORD_SIZE);
     vector<bool> pc = vector<bool>(ADDR_SIZE);
     int cycle = 0;
+    // Number of times each instruction got executed and each data word got
+    // accessed since the machine was switched on. Shown by the heatmap.
+    vector<size_t> codeHeat = vector<size_t>(RAM_SIZE);
+    vector<size_t> dataHeat = vector<size_t>(RAM_SIZE);
+    void countAccesses(const Instruction &inst);
+    void recordCycle();
+    void recordChanges(const Instruction &inst);
+    // If set, every executed cycle gets recorded into it.
+    ExecutionLog *log = NULL;
 };
 
 #endif
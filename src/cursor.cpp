@@ -12,13 +12,20 @@
 
 using namespace std;
 
-map<int, Instruction> Cursor::BOUND_DATA_ADDRESSES = { 
-    { INIT_OPERAND_INDEX, Instruction(INIT_INSTRUCTION, EMPTY_WORD, NULL) },
-    { AND_OPERAND_INDEX, Instruction(AND_INSTRUCTION, EMPTY_WORD, NULL) },
-    { OR_OPERAND_INDEX, Instruction(OR_INSTRUCTION, EMPTY_WORD, NULL) },
-    { LAST_XOR_OPERAND_INDEX, 
-      Instruction(LAST_XOR_INSTRUCTION, EMPTY_WORD, NULL) }
-};
+/*
+ * Gets built on first use, so that it isn't constructed at startup when
+ * not in interactive mode.
+ */
+const map<int, Instruction> &Cursor::getBoundDataAddresses() {
+  static const map<int, Instruction> boundDataAddresses = { 
+      { INIT_OPERAND_INDEX, Instruction(INIT_INSTRUCTION, EMPTY_WORD, NULL) },
+      { AND_OPERAND_INDEX, Instruction(AND_INSTRUCTION, EMPTY_WORD, NULL) },
+      { OR_OPERAND_INDEX, Instruction(OR_INSTRUCTION, EMPTY_WORD, NULL) },
+      { LAST_XOR_OPERAND_INDEX, 
+        Instruction(LAST_XOR_INSTRUCTION, EMPTY_WORD, NULL) }
+  };
+  return boundDataAddresses;
+}
 
 // map<SpecificInstruction, set<int>> Cursor::VALID_ADDRESSES = {
 //   { Read, { 0, 1, 2} }
@@ -223,15 +230,21 @@ void Cursor::decreaseByteValue() {
 /////////// PRIVATE //////////
 //////////////////////////////
 
+/*
+ * Ram can also be changed by cpu or by loading a file, so it first gets
+ * reindexed. Only changed words are reindexed.
+ */
+const ReferenceIndex &Cursor::getIndex() {
+  index.update(ram);
+  return index;
+}
+
 int Cursor::getIndexOfMovable(bool predecessor) {
   Address curAdr = getAddress();
-  vector<Instruction> instructions = 
-      Instruction::getEffectiveInstructions(ram, EMPTY_WORD);
   if (predecessor) {
     for (int i = getY()-1; i >= 0; i--) {
       Address iAdr = Address(addrSpace, Util::getBoolNibb(i));
-      if (adrMovableTo(curAdr, iAdr, instructions) &&
-          adrMovableTo(iAdr, curAdr, instructions)) {
+      if (adrMovableTo(curAdr, iAdr) && adrMovableTo(iAdr, curAdr)) {
         return i;
       }
     }
@@ -239,8 +252,7 @@ int Cursor::getIndexOfMovable(bool predecessor) {
   } else {
     for (int i = getY()+1; i < RAM_SIZE; i++) {
       Address iAdr = Address(addrSpace, Util::getBoolNibb(i));
-      if (adrMovableTo(curAdr, iAdr, instructions) &&
-          adrMovableTo(iAdr, curAdr, instructions)) {
+      if (adrMovableTo(curAdr, iAdr) && adrMovableTo(iAdr, curAdr)) {
         return i;
       }
     }
@@ -251,8 +263,7 @@ int Cursor::getIndexOfMovable(bool predecessor) {
 /*
  * Returns whether word at address can be moved up or down one spot.
  */
-bool Cursor::adrMovableTo(Address &from, Address &to,  
-                          vector<Instruction> &instructions) {
+bool Cursor::adrMovableTo(Address &from, Address &to) {
   int fromIndex = Util::getInt(from.val);
   int toIndex = Util::getInt(to.val);
   bool indexOutOfBounds = toIndex < 0 || toIndex >= RAM_SIZE;
@@ -276,8 +287,8 @@ bool Cursor::adrMovableTo(Address &from, Address &to,
   if (!addressCouldBeBound(fromIndex)) {
     return true;
   }
-  Instruction boundingInst = BOUND_DATA_ADDRESSES.at(fromIndex);
-  if (instructionExists(boundingInst, instructions)) {
+  Instruction boundingInst = getBoundDataAddresses().at(fromIndex);
+  if (instructionExists(boundingInst)) {
     return false;
   }
   // Check if it is bound by xor instruction and toIndex is past 
@@ -289,7 +300,7 @@ bool Cursor::adrMovableTo(Address &from, Address &to,
     Instruction xorInstruction = 
         Instruction( { false, true, true, true, true, from.val[1], from.val[2], 
                        from.val[3]}, EMPTY_WORD, &ram);
-    if (instructionExists(xorInstruction, instructions)) {
+    if (instructionExists(xorInstruction)) {
       if (toIndex > LAST_XOR_OPERAND_INDEX) {
         return false;
       }
@@ -399,26 +410,13 @@ bool Cursor::addressUsed(Address adr) {
 }
 
 bool Cursor::addressReferenced(Address adr) {
-  vector<Address> addresses = getAddressesOfEffectiveInstructions();
-  return find(addresses.begin(), addresses.end(), adr) != addresses.end();
-}
-
-vector<Address> Cursor::getAddressesOfEffectiveInstructions() {
-  vector<Address> out;
-  vector<Instruction> instructions = 
-      Instruction::getEffectiveInstructions(ram, EMPTY_WORD);
-  for (Instruction inst : instructions) {
-    out.push_back(inst.firstOrderAdr.back()); // USED TO BE [0]!!!
-  }
-  return out;
+  return getIndex().addressReferenced(adr.space, Util::getInt(adr.val));
 }
 
 /*
  * Returns bound address index or 0 if none.
  */
 int Cursor::getFirstBoundDataAdr(bool insert, int y) {
-  vector<Instruction> instructions = 
-      Instruction::getEffectiveInstructions(ram, EMPTY_WORD);
   int lastAddressToCheck = LAST_XOR_OPERAND_INDEX;
   // For delete we don't need to check if there exists xor instruction, that
   // has 8th address.
@@ -427,8 +425,8 @@ int Cursor::getFirstBoundDataAdr(bool insert, int y) {
   }
   for (int i = y; i <= lastAddressToCheck; i++) {
     if (addressCouldBeBound(i)) {
-      Instruction boundingInst = BOUND_DATA_ADDRESSES.at(i);
-      if (instructionExists(boundingInst, instructions)) {
+      Instruction boundingInst = getBoundDataAddresses().at(i);
+      if (instructionExists(boundingInst)) {
         return i;
       }
     }
@@ -437,13 +435,11 @@ int Cursor::getFirstBoundDataAdr(bool insert, int y) {
 }
 
 bool Cursor::addressCouldBeBound(int index) {
-  return BOUND_DATA_ADDRESSES.find(index) != BOUND_DATA_ADDRESSES.end();
+  return getBoundDataAddresses().count(index) > 0;
 }
 
-bool Cursor::instructionExists(Instruction &inst, 
-                               vector<Instruction> &instructions) {
-  return find(instructions.begin(), instructions.end(), inst) != 
-              instructions.end();
+bool Cursor::instructionExists(const Instruction &inst) {
+  return getIndex().instructionExists(Util::getInt(inst.val));
 }
 
 Address Cursor::getLastRedundandAdr(AddrSpace addrSpaceIn) {
@@ -466,23 +462,12 @@ Address Cursor::getLastRedundandAdr(AddrSpace addrSpaceIn) {
 
 void Cursor::incOrDecAddressesInRange(AddrSpace space, int indexStart, 
                                       int indexEnd, int delta) {
-  vector<Instruction> allInstructions = 
-      Instruction::getAllInstructions(ram, EMPTY_WORD);
-  int indexOfLastInst = 
-      Instruction::getIndexOfLastNonEmptyInst(allInstructions);
-  for (int i = 0; i <= indexOfLastInst; i++) {
+  vector<int> instructions =
+      getInstructionsReferencingRange(space, indexStart, indexEnd);
+  for (int i : instructions) {
     vector<bool> &word = ram.state[CODE].at(i);
-    Instruction inst = Instruction(word, EMPTY_WORD, &ram);
-    Address adr = inst.firstOrderAdr[0];
-    int adrVal = Util::getInt(adr.val);
-    bool instPointingToSpace = adr.space == space;
-    bool adrPastTheStart = adrVal >= indexStart;
-    bool adrBeforeTheEnd = adrVal < indexEnd;
-    bool notLastAdr = adr.val != LAST_ADDRESS;
-    if (instPointingToSpace && adrPastTheStart && adrBeforeTheEnd && notLastAdr) {
-      int newVal = adrVal + delta;
-      setAddress(word, newVal, inst.inst->getAdrIndex());
-    }
+    const DecodedInstruction &inst = DECODE_TABLE[Util::getInt(word)];
+    setAddress(word, inst.adr + delta, inst.adrIndex);
   }
 }
 
@@ -491,26 +476,39 @@ void Cursor::swithcValuesAndReferences(AddrSpace space, int from, int to) {
   actuallyMove(space, from, to);
 }
 
-// TODO: HEAVY DUPLICATION!
 void Cursor::updateAddresses(AddrSpace space, int from, int to) {
-  vector<Instruction> allInstructions = 
-      Instruction::getAllInstructions(ram, EMPTY_WORD);
-  int indexOfLastInst = 
-      Instruction::getIndexOfLastNonEmptyInst(allInstructions);
-  for (int i = 0; i <= indexOfLastInst; i++) {
-    vector<bool> &word = ram.state[CODE].at(i);
-    Instruction inst = Instruction(word, EMPTY_WORD, &ram);
-    Address adr = inst.firstOrderAdr[0];
-    int adrVal = Util::getInt(adr.val);
-    if (adr.space != space) {
-      continue;
-    }
-    if (adrVal == from) {
-      setAddress(word, to, inst.inst->getAdrIndex());
-    } else if (adrVal == to) {
-      setAddress(word, from, inst.inst->getAdrIndex());
+  vector<int> instFrom = getInstructionsReferencingRange(space, from, from+1);
+  vector<int> instTo = getInstructionsReferencingRange(space, to, to+1);
+  for (int i : instFrom) {
+    setAddress(ram.state[CODE].at(i), to, DECODE_TABLE[
+        Util::getInt(ram.state[CODE].at(i))].adrIndex);
+  }
+  for (int i : instTo) {
+    setAddress(ram.state[CODE].at(i), from, DECODE_TABLE[
+        Util::getInt(ram.state[CODE].at(i))].adrIndex);
+  }
+}
+
+/*
+ * Returns indexes of effective instructions whose address is written in
+ * the word and is in the range, so it can be changed. Instructions with a
+ * fixed address (logic instructions) can't be changed, and neither can the
+ * ones that point to the last address.
+ */
+vector<int> Cursor::getInstructionsReferencingRange(AddrSpace space,
+                                                    int indexStart,
+                                                    int indexEnd) {
+  vector<int> out;
+  const ReferenceIndex &refs = getIndex();
+  indexEnd = min(indexEnd, RAM_SIZE);
+  for (int adr = max(indexStart, 0); adr < indexEnd; adr++) {
+    for (int i : refs.getReferencingInstructions(space, adr)) {
+      if (DECODE_TABLE[Util::getInt(ram.state[CODE].at(i))].adrIndex != -1) {
+        out.push_back(i);
+      }
     }
   }
+  return out;
 }
 
 void Cursor::setAddress(vector<bool> &word, int newAdrVal, int adrIndex) {
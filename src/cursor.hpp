@@ -9,6 +9,7 @@
 #include "axis.hpp"
 #include "instruction.hpp"
 #include "ram.hpp"
+#include "reference_index.hpp"
 
 using namespace std;
 
@@ -66,13 +67,16 @@ class Cursor {
     // Selected bit with the cursor.
     map<AddrSpace, map<Axis, int>> cursorPosition;
     // Map of data addresses to instructions that use them.
-    static map<int, Instruction> BOUND_DATA_ADDRESSES;
+    static const map<int, Instruction> &getBoundDataAddresses();
+    // References of the effective instructions. Use it through getIndex(),
+    // that brings it up to date with the ram.
+    ReferenceIndex index;
 
     // static map<SpecificInstruction, set<int>> VALID_ADDRESSES;
 
+    const ReferenceIndex &getIndex();
     int getIndexOfMovable(bool predecessor);
-    bool adrMovableTo(Address &from, Address &to,  
-                      vector<Instruction> &instructions);
+    bool adrMovableTo(Address &from, Address &to);
     bool insertByteAndMoveRestDown(Address adr);
     bool deleteByteAndMoveRestUp(Address adr);
     int canModifyTo(bool insert, Address adr);
@@ -81,15 +85,15 @@ class Cursor {
     int canDeleteTo(Address adr);
     bool addressUsed(Address adr);
     bool addressReferenced(Address adr);
-    vector<Address> getAddressesOfEffectiveInstructions();
     int getFirstBoundDataAdr(bool insert, int y);
     bool addressCouldBeBound(int index);
-    bool instructionExists(Instruction &inst, 
-                           vector<Instruction> &instructions);
+    bool instructionExists(const Instruction &inst);
     void incOrDecAddressesInRange(AddrSpace space, int indexStart, 
                                       int indexEnd, int delta);
     void swithcValuesAndReferences(AddrSpace space, int from, int to);
     void updateAddresses(AddrSpace space, int from, int to);
+    vector<int> getInstructionsReferencingRange(AddrSpace space,
+                                                int indexStart, int indexEnd);
     Address getLastRedundandAdr(AddrSpace addrSpaceIn);
     static void setAddress(vector<bool> &word, int val, int adrIndex);
     void actuallyInsert(Address adr, int until);
@@ -0,0 +1,281 @@
+#include "debugger.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "const.hpp"
+#include "decode_table.hpp"
+#include "fast_cpu.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+vector<Debugger::Breakpoint> Debugger::breakpoints;
+FILE *Debugger::terminal = NULL;
+
+void Debugger::addBreakpoint(const string &spec) {
+  breakpoints.push_back(parse(spec, false));
+}
+
+void Debugger::addWatchpoint(const string &spec) {
+  breakpoints.push_back(parse(spec, true));
+}
+
+bool Debugger::enabled() {
+  return !breakpoints.empty();
+}
+
+void Debugger::setName(const string &nameIn) {
+  name = nameIn;
+}
+
+/*
+ * Gets called before every instruction. If cycles were skipped (executed by
+ * some other cpu), log starts again.
+ */
+void Debugger::record(const FastCpu &cpu) {
+  log.record(cpu.cycle, cpu.pc, cpu.reg, cpu.data);
+}
+
+/*
+ * Gets called before every instruction. Updates the state of all the
+ * breakpoints, and returns whether any of them was hit, or the requested
+ * number of steps was executed.
+ */
+bool Debugger::shouldStop(const FastCpu &cpu) {
+  if (held.empty()) {
+    held.resize(breakpoints.size());
+    for (const Breakpoint &breakpoint : breakpoints) {
+      int adr = breakpoint.watchedAdr;
+      watchedValues.push_back(adr < 0 ? 0 : cpu.data[adr]);
+    }
+  }
+  hits.clear();
+  for (size_t i = 0; i < breakpoints.size(); i++) {
+    const Breakpoint &breakpoint = breakpoints[i];
+    bool holdsNow = true;
+    for (const Condition &condition : breakpoint.conditions) {
+      holdsNow = holdsNow && holds(condition, cpu);
+    }
+    bool hit = holdsNow && !held[i];
+    int adr = breakpoint.watchedAdr;
+    if (adr >= 0) {
+      hit = holdsNow && cpu.data[adr] != watchedValues[i];
+      watchedValues[i] = cpu.data[adr];
+    }
+    held[i] = holdsNow;
+    if (hit) {
+      hits.push_back(breakpoint.spec);
+    }
+  }
+  bool stepped = stepsLeft > 0 && --stepsLeft == 0;
+  return stepped || !hits.empty();
+}
+
+/*
+ * Prints the state, and if process has a terminal, reads the commands from
+ * it until execution should continue. Stepping back only changes the state
+ * that gets printed, execution always continues from the present cycle.
+ */
+void Debugger::stop(const FastCpu &cpu) {
+  cout.flush();
+  for (const string &hit : hits) {
+    fprintf(stderr, "Hit '%s' in %s at cycle %ld.\n", hit.c_str(),
+            name.c_str(), cpu.cycle);
+  }
+  printState(cpu);
+  if (terminal == NULL) {
+    terminal = fopen("/dev/tty", "r");
+    if (terminal == NULL) {
+      return;
+    }
+  }
+  FastCpu past = cpu;
+  while (true) {
+    fprintf(stderr, "(s)tep [n], (b)ack [n], (c)ontinue, (p)rint, "
+                    "(q)uit: ");
+    string command = readCommand();
+    if (command.empty() || command[0] == 'c') {
+      return;
+    } else if (command[0] == 's') {
+      stepsLeft = parseCount(command);
+      return;
+    } else if (command[0] == 'b') {
+      long cycle = past.cycle - parseCount(command);
+      long firstCycle = log.getFirstCycle(cpu.cycle);
+      if (cycle < firstCycle) {
+        fprintf(stderr, "Only last %ld cycles can be stepped back through.\n",
+                cpu.cycle - firstCycle);
+        cycle = firstCycle;
+      }
+      past = cpu;
+      log.rewind(past, cycle);
+      printState(past);
+    } else if (command[0] == 'p') {
+      printState(past);
+    } else if (command[0] == 'q') {
+      exit(0);
+    }
+  }
+}
+
+/// PRIVATE ///
+
+/*
+ * Watchpoint must start with the data word, the rest are conditions.
+ */
+Debugger::Breakpoint Debugger::parse(const string &spec, bool watch) {
+  Breakpoint breakpoint = { spec, { }, -1 };
+  vector<string> parts;
+  stringstream stream(spec);
+  string part;
+  while (getline(stream, part, ',')) {
+    parts.push_back(part);
+  }
+  if (parts.empty()) {
+    cerr << "Breakpoint can't be empty. Aborting." << endl;
+    exit(1);
+  }
+  for (size_t i = 0; i < parts.size(); i++) {
+    if (watch && i == 0) {
+      bool isWord = parts[0].compare(0, 5, "data[") == 0 &&
+                    parts[0].find_first_of("=!<>") == string::npos;
+      if (!isWord) {
+        cerr << "Watchpoint '" << spec << "' must start with a data word "
+             << "(like 'data[5]'). Aborting." << endl;
+        exit(1);
+      }
+      Condition word = parseCondition(parts[0] + "=0", spec);
+      breakpoint.watchedAdr = word.adr;
+    } else {
+      breakpoint.conditions.push_back(parseCondition(parts[i], spec));
+    }
+  }
+  return breakpoint;
+}
+
+/*
+ * Parses 'pc', 'reg' or 'data[<adr>]', followed by '=', '!=', '<' or '>',
+ * and a number.
+ */
+Debugger::Condition Debugger::parseCondition(const string &spec,
+                                             const string &whole) {
+  size_t opIndex = spec.find_first_of("=!<>");
+  if (opIndex == string::npos) {
+    cerr << "Condition '" << spec << "' of '" << whole << "' has no "
+         << "relation. Aborting." << endl;
+    exit(1);
+  }
+  string subject = spec.substr(0, opIndex);
+  Condition condition = { REG, 0, EQUAL, 0 };
+  if (subject == "pc") {
+    condition.subject = PC;
+  } else if (subject == "reg") {
+    condition.subject = REG;
+  } else if (subject.compare(0, 5, "data[") == 0 &&
+             Util::endsWith(subject, "]")) {
+    condition.subject = DATA;
+    condition.adr = parseNumber(subject.substr(5, subject.size() - 6), whole);
+    if (condition.adr >= RAM_SIZE) {
+      cerr << "Address in '" << whole << "' must be smaller than "
+           << RAM_SIZE << ". Aborting." << endl;
+      exit(1);
+    }
+  } else {
+    cerr << "Unknown '" << subject << "' in '" << whole << "', use 'pc', "
+         << "'reg' or 'data[<adr>]'. Aborting." << endl;
+    exit(1);
+  }
+  string relation = spec.substr(opIndex, spec[opIndex] == '!' ? 2 : 1);
+  if (relation[0] == '!' && relation != "!=") {
+    cerr << "Unknown relation in '" << spec << "' of '" << whole << "', "
+         << "use '=', '!=', '<' or '>'. Aborting." << endl;
+    exit(1);
+  }
+  condition.relation = relation == "!=" ? NOT_EQUAL :
+                       relation == "<" ? LESS :
+                       relation == ">" ? GREATER : EQUAL;
+  condition.value = parseNumber(spec.substr(opIndex + relation.size()),
+                                whole);
+  return condition;
+}
+
+int Debugger::parseNumber(const string &s, const string &whole) {
+  bool valid = !s.empty() && s.size() <= 3 &&
+               s.find_first_not_of("0123456789") == string::npos;
+  if (!valid || stoi(s) > MAX_VALUE) {
+    cerr << "Invalid number '" << s << "' in '" << whole << "'. Aborting."
+         << endl;
+    exit(1);
+  }
+  return stoi(s);
+}
+
+bool Debugger::holds(const Condition &condition, const FastCpu &cpu) {
+  int value = condition.subject == PC ? cpu.pc :
+              condition.subject == REG ? cpu.reg : cpu.data[condition.adr];
+  switch (condition.relation) {
+    case NOT_EQUAL:
+      return value != condition.value;
+    case LESS:
+      return value < condition.value;
+    case GREATER:
+      return value > condition.value;
+    default:
+      return value == condition.value;
+  }
+}
+
+/*
+ * Prints name of the computer, pc with the instruction it points to,
+ * register, and data words.
+ */
+void Debugger::printState(const FastCpu &cpu) const {
+  string instruction = "STOP";
+  if (cpu.pc < RAM_SIZE) {
+    const DecodedInstruction &inst = DECODE_TABLE[cpu.code[cpu.pc]];
+    string label = inst.label;
+    label.erase(label.find_last_not_of(' ') + 1);
+    instruction = Util::getString(Util::getBoolByte(cpu.code[cpu.pc])) +
+                  " " + label;
+  }
+  fprintf(stderr, "%s, cycle %ld\npc       %2d  %s\nreg      %s %3d\n",
+          name.c_str(), cpu.cycle, cpu.pc, instruction.c_str(),
+          Util::getString(Util::getBoolByte(cpu.reg)).c_str(), cpu.reg);
+  for (int i = 0; i < RAM_SIZE; i++) {
+    fprintf(stderr, "data[%2d] %s %3d\n", i,
+            Util::getString(Util::getBoolByte(cpu.data[i])).c_str(),
+            cpu.data[i]);
+  }
+}
+
+/*
+ * Returns the line without the new line, or "q" at the end of the input.
+ */
+string Debugger::readCommand() {
+  char line[256];
+  if (fgets(line, sizeof(line), terminal) == NULL) {
+    return "q";
+  }
+  string command = line;
+  while (!command.empty() && (command.back() == '\n' ||
+                              command.back() == '\r')) {
+    command.pop_back();
+  }
+  return command;
+}
+
+/*
+ * Returns the number that follows the command letter, or 1 if there is
+ * none.
+ */
+long Debugger::parseCount(const string &command) {
+  size_t space = command.find(' ');
+  long count = space == string::npos ? 1 : atol(&command[space]);
+  return max(count, 1L);
+}
@@ -0,0 +1,78 @@
+#ifndef DEBUGGER_H
+#define DEBUGGER_H
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "const.hpp"
+#include "execution_log.hpp"
+
+using namespace std;
+
+class FastCpu;
+
+/*
+ * Breakpoints and watchpoints of the non-interactive mode. Breakpoint is
+ * a list of conditions on pc, register and data words (like 'pc=3,reg>10'),
+ * and it is hit when all of them start to hold. Watchpoint names a data word
+ * ('data[5]', optionally followed by conditions), and is hit when its value
+ * changes. When hit, state of the machine gets printed to stderr, and if
+ * there is a terminal, execution stops and waits for the commands.
+ *
+ * Only the fast cpu checks them, and only through the instantiation of its
+ * loop that is used when debugger is attached (see 'FastCpu::run()'). The
+ * same loop also records the cycles into the execution log, so the state of
+ * the last EXECUTION_LOG_CYCLES cycles can be viewed when stopped.
+ */
+class Debugger {
+  public:
+    static void addBreakpoint(const string &spec);
+    static void addWatchpoint(const string &spec);
+    static bool enabled();
+    void setName(const string &nameIn);
+    void record(const FastCpu &cpu);
+    bool shouldStop(const FastCpu &cpu);
+    void stop(const FastCpu &cpu);
+
+  private:
+    enum Subject { PC, REG, DATA };
+    enum Relation { EQUAL, NOT_EQUAL, LESS, GREATER };
+    struct Condition {
+      Subject subject;
+      int adr;
+      Relation relation;
+      int value;
+    };
+    struct Breakpoint {
+      string spec;
+      vector<Condition> conditions;
+      // Address of the watched data word, or -1 if it's a breakpoint.
+      int watchedAdr;
+    };
+    static vector<Breakpoint> breakpoints;
+    static FILE *terminal;
+
+    // Whether conditions of each breakpoint held at the last check, and
+    // the last seen values of the watched words.
+    vector<bool> held;
+    vector<int> watchedValues;
+    // Number of instructions to execute before stopping again.
+    long stepsLeft = 0;
+    vector<string> hits;
+    ExecutionLog log;
+    // Computer of the chain that the debugger belongs to, as it appears in
+    // the printed messages.
+    string name = "computer";
+
+    static Breakpoint parse(const string &spec, bool watch);
+    static Condition parseCondition(const string &spec, const string &whole);
+    static int parseNumber(const string &s, const string &whole);
+    static bool holds(const Condition &condition, const FastCpu &cpu);
+    void printState(const FastCpu &cpu) const;
+    static string readCommand();
+    static long parseCount(const string &command);
+};
+
+#endif
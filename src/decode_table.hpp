@@ -0,0 +1,102 @@
+#ifndef DECODE_TABLE_H
+#define DECODE_TABLE_H
+
+#include "addr_space.hpp"
+#include "const.hpp"
+
+using namespace std;
+
+enum Opcode { READ, WRITE, ADD, SUB, JUMP, IF_MAX, IF_MIN, JUMP_REG, READ_REG,
+              INIT, NOT, SHIFT_LEFT, SHIFT_RIGHT, AND, OR, XOR, READ_POINTER,
+              WRITE_POINTER, INCREASE, DECREASE, PRINT, IF_NOT_MAX,
+              IF_NOT_MIN, NUM_OF_OPCODES };
+
+/*
+ * Everything that can be known about an instruction from its word alone.
+ * Address is the first order address (the one that is written in the word,
+ * or the fixed one of the logic instructions), and 'adrIndex' is the index
+ * of the bit where it starts in the word, or -1 if it is fixed.
+ */
+struct DecodedInstruction {
+  Opcode opcode;
+  AddrSpace space;
+  int adr;
+  bool threeBitAdr;
+  int adrIndex;
+  const char *label;
+};
+
+namespace decode_table {
+
+  constexpr DecodedInstruction get(Opcode opcode, AddrSpace space, int adr,
+                                   bool threeBitAdr, int adrIndex,
+                                   const char *label) {
+    return { opcode, space, adr, threeBitAdr, adrIndex, label };
+  }
+
+  constexpr DecodedInstruction withAdr(Opcode opcode, AddrSpace space,
+                                       int byte, const char *label) {
+    return get(opcode, space, byte & 0x0f, false, 4, label);
+  }
+
+  constexpr DecodedInstruction withThreeBitAdr(Opcode opcode, int byte,
+                                               const char *label) {
+    return get(opcode, DATA, byte & 0x07, true, 5, label);
+  }
+
+  constexpr DecodedInstruction withFixedAdr(Opcode opcode, AddrSpace space,
+                                            int adr) {
+    return get(opcode, space, adr, false, -1, "JRI~<>&VX");
+  }
+
+  constexpr DecodedInstruction logic(int byte) {
+    return (byte & 0x0f) == 0 ? withFixedAdr(JUMP_REG, NONE, 0) :
+           (byte & 0x0f) == 1 ? withFixedAdr(READ_REG, NONE, 0) :
+           (byte & 0x0f) == 2 ? withFixedAdr(INIT, DATA, 0) :
+           (byte & 0x0f) == 3 ? withFixedAdr(NOT, NONE, 0) :
+           (byte & 0x0f) == 4 ? withFixedAdr(SHIFT_LEFT, NONE, 0) :
+           (byte & 0x0f) == 5 ? withFixedAdr(SHIFT_RIGHT, NONE, 0) :
+           (byte & 0x0f) == 6 ? withFixedAdr(AND, DATA, AND_OPERAND_INDEX) :
+           (byte & 0x0f) == 7 ? withFixedAdr(OR, DATA, OR_OPERAND_INDEX) :
+           withThreeBitAdr(XOR, byte, "JRI~<>&VX");
+  }
+
+  constexpr DecodedInstruction decode(int byte) {
+    return (byte >> 4) == 1 ? withAdr(WRITE, DATA, byte, "WRITE  ") :
+           (byte >> 4) == 2 ? withAdr(ADD, DATA, byte, "ADD") :
+           (byte >> 4) == 3 ? withAdr(SUB, DATA, byte, "SUB") :
+           (byte >> 4) == 4 ? withAdr(JUMP, CODE, byte, "JUMP") :
+           (byte >> 4) == 5 ? withAdr(IF_MAX, CODE, byte, "IF MAX") :
+           (byte >> 4) == 6 ? withAdr(IF_MIN, CODE, byte, "IF MIN") :
+           (byte >> 4) == 7 ? logic(byte) :
+           (byte >> 4) == 8 ? withAdr(READ_POINTER, DATA, byte, "READ *") :
+           (byte >> 4) == 9 ? withAdr(WRITE_POINTER, DATA, byte, "WRITE *") :
+           (byte >> 4) == 10 ? withThreeBitAdr((byte & 0x08) ? DECREASE :
+                                               INCREASE, byte, "INC/DEC") :
+           (byte >> 4) == 11 ? withAdr(PRINT, DATA, byte, "PRINT") :
+           (byte >> 4) == 13 ? withAdr(IF_NOT_MAX, CODE, byte, "IF NOT MAX") :
+           (byte >> 4) == 14 ? withAdr(IF_NOT_MIN, CODE, byte, "IF NOT MIN") :
+           withAdr(READ, DATA, byte, "READ  ");
+  }
+
+}
+
+#define DECODE_4(i) decode_table::decode(i), decode_table::decode(i+1), \
+                    decode_table::decode(i+2), decode_table::decode(i+3)
+#define DECODE_16(i) DECODE_4(i), DECODE_4(i+4), DECODE_4(i+8), DECODE_4(i+12)
+#define DECODE_64(i) DECODE_16(i), DECODE_16(i+16), DECODE_16(i+32), \
+                     DECODE_16(i+48)
+
+/*
+ * Decoded instruction for every possible instruction word, indexed by its
+ * value. Used by the cpus, the editor and the parser.
+ */
+constexpr DecodedInstruction DECODE_TABLE[256] = {
+  DECODE_64(0), DECODE_64(64), DECODE_64(128), DECODE_64(192)
+};
+
+#undef DECODE_4
+#undef DECODE_16
+#undef DECODE_64
+
+#endif
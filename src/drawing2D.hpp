@@ -1,277 +1,36 @@
 #ifndef DRAWING_2D_H
 #define DRAWING_2D_H
 
-#include <string>
-#include <vector>
-
-using namespace std;
+#include "view.hpp"
 
 // Automaticaly generated file from resources/drawing textfile.
 // Do not edit this line.
 
-const vector<string> drawing2D = {u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0043", 
-u8"\u0050", u8"\u0055", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u0020", 
-u8"\u0020", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u000D", u8"\u000A", u8"\u0050", u8"\u0043", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0043", u8"\u004F", u8"\u0044", u8"\u0045", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u005B", u8"\u0072", 
-u8"\u0072", u8"\u0072", u8"\u0072", u8"\u0072", u8"\u0072", u8"\u0072", 
-u8"\u0072", u8"\u005D", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0044", u8"\u0041", u8"\u0054", u8"\u0041", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0041", u8"\u0044", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u005F", u8"\u0020", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u007C", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u0020", 
-u8"\u005F", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", 
-u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002D", u8"\u002D", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0052", u8"\u0045", u8"\u0041", u8"\u0044", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002D", 
-u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", 
-u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002D", u8"\u002A", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0057", u8"\u0052", u8"\u0049", u8"\u0054", 
-u8"\u0045", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002D", 
-u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", 
-u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002A", u8"\u002D", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0041", u8"\u0044", u8"\u0044", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002A", 
-u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", 
-u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002A", u8"\u002A", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0053", u8"\u0055", u8"\u0042", u8"\u0054", 
-u8"\u0052", u8"\u0041", u8"\u0043", u8"\u0054", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002D", u8"\u002A", 
-u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0050", u8"\u0052", u8"\u0049", u8"\u004E", 
-u8"\u0054", u8"\u0045", u8"\u0052", u8"\u0020", u8"\u0020", u8"\u000D", 
-u8"\u000A", u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002A", u8"\u002D", u8"\u002D", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u004A", u8"\u0055", u8"\u004D", 
-u8"\u0050", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002A", 
-u8"\u002D", u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u007C", u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u0020", u8"\u000D", u8"\u000A", u8"\u007C", u8"\u0067", 
-u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", u8"\u0020", u8"\u002D", 
-u8"\u002A", u8"\u002D", u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u0049", u8"\u0046", u8"\u0020", u8"\u004D", u8"\u0041", u8"\u0058", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u002D", u8"\u002A", u8"\u002D", u8"\u002A", u8"\u0020", 
-u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", u8"\u0076", u8"\u007C", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u000D", 
-u8"\u000A", u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002A", u8"\u002A", u8"\u002D", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0049", u8"\u0046", u8"\u0020", 
-u8"\u004D", u8"\u0049", u8"\u004E", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002A", 
-u8"\u002A", u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u007C", u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0028", 
-u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u003D", 
-u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", 
-u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", 
-u8"\u005B", u8"\u005D", u8"\u003D", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0029", u8"\u000D", u8"\u000A", u8"\u007C", 
-u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", u8"\u0020", 
-u8"\u002D", u8"\u002A", u8"\u002A", u8"\u002A", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u004A", u8"\u0052", u8"\u0049", u8"\u007E", u8"\u003C", 
-u8"\u003E", u8"\u0026", u8"\u0056", u8"\u0058", u8"\u0020", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u002D", u8"\u002A", u8"\u002A", u8"\u002A", 
-u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", u8"\u0076", 
-u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u005F", 
-u8"\u005F", u8"\u0020", u8"\u005F", u8"\u0020", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u0020", u8"\u005F", u8"\u0020", u8"\u005F", u8"\u005F", u8"\u007C", 
-u8"\u000D", u8"\u000A", u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002D", u8"\u002D", 
-u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0052", u8"\u0045", 
-u8"\u0041", u8"\u0044", u8"\u0020", u8"\u002A", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002A", 
-u8"\u002D", u8"\u002D", u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u007C", u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u000D", u8"\u000A", u8"\u007C", 
-u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", u8"\u0020", 
-u8"\u002A", u8"\u002D", u8"\u002D", u8"\u002A", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u0057", u8"\u0052", u8"\u0049", u8"\u0054", u8"\u0045", 
-u8"\u0020", u8"\u002A", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002D", u8"\u002D", u8"\u002A", 
-u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", u8"\u0076", 
-u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", u8"\u007C", u8"\u000D", 
-u8"\u000A", u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002D", u8"\u002A", u8"\u002D", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0049", u8"\u004E", u8"\u0043", 
-u8"\u002F", u8"\u0044", u8"\u0045", u8"\u0043", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002D", 
-u8"\u002A", u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u007C", u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u000D", u8"\u000A", u8"\u007C", u8"\u0067", 
-u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", u8"\u0020", u8"\u002A", 
-u8"\u002D", u8"\u002A", u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u0050", u8"\u0052", u8"\u0049", u8"\u004E", u8"\u0054", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u002A", u8"\u002D", u8"\u002A", u8"\u002A", u8"\u0020", 
-u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", u8"\u0076", u8"\u007C", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u0020", u8"\u007C", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", 
-u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002D", u8"\u002D", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002D", 
-u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", u8"\u007C", 
-u8"\u000D", u8"\u000A", u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002D", 
-u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0049", u8"\u0046", 
-u8"\u0020", u8"\u004E", u8"\u004F", u8"\u0054", u8"\u0020", u8"\u004D", 
-u8"\u0041", u8"\u0058", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002A", 
-u8"\u002A", u8"\u002D", u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u007C", u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u0020", u8"\u007C", u8"\u000D", u8"\u000A", u8"\u007C", u8"\u0067", 
-u8"\u007C", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u007C", u8"\u0020", u8"\u002A", 
-u8"\u002A", u8"\u002A", u8"\u002D", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u0049", u8"\u0046", u8"\u0020", u8"\u004E", u8"\u004F", u8"\u0054", 
-u8"\u0020", u8"\u004D", u8"\u0049", u8"\u004E", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002A", u8"\u002D", u8"\u0020", 
-u8"\u007C", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u007C", u8"\u0076", u8"\u007C", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u007C", u8"\u0020", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u0020", u8"\u007C", u8"\u000D", u8"\u000A", 
-u8"\u007C", u8"\u0067", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0053", 
-u8"\u0054", u8"\u004F", u8"\u0050", u8"\u0020", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002A", u8"\u002A", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u002A", u8"\u002A", u8"\u002A", 
-u8"\u002A", u8"\u0020", u8"\u007C", u8"\u0020", u8"\u0049", u8"\u004E", 
-u8"\u002F", u8"\u004F", u8"\u0055", u8"\u0054", u8"\u0020", u8"\u007C", 
-u8"\u0076", u8"\u007C", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", u8"\u007C", 
-u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", u8"\u0023", 
-u8"\u0023", u8"\u0020", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", 
-u8"\u005B", u8"\u005D", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u005B", u8"\u005D", u8"\u0020", u8"\u005C", u8"\u005F", u8"\u005F", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u002F", u8"\u0020", 
-u8"\u005B", u8"\u005D", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u005B", u8"\u005D", u8"\u0020", u8"\u005C", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", 
-u8"\u002F", u8"\u0020", u8"\u005B", u8"\u005D", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u005B", u8"\u005D", u8"\u0020", u8"\u005C", 
-u8"\u005F", u8"\u005F", u8"\u005F", u8"\u005F", u8"\u002F", u8"\u0020", 
-u8"\u005B", u8"\u005D", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u005B", u8"\u005D", u8"\u0020", u8"\u000D", u8"\u000A"
+const Drawing drawing2D = {
+  23, 90,
+  u8"                            CPU            \n"
+  u8"                        ____________  \n"
+  u8"                       |            | \n"
+  u8"     PC   CODE         | [rrrrrrrr] |         DATA   AD\n"
+  u8"      _ ________       |____________|       ________ _        \n"
+  u8"cccc |g|aaaaaaaa| ---- | READ       | ---- |bbbbbbbb|v| dddd  \n"
+  u8"cccc |g|aaaaaaaa| ---* | WRITE      | ---* |bbbbbbbb|v| dddd  \n"
+  u8"cccc |g|aaaaaaaa| --*- | ADD        | --*- |bbbbbbbb|v| dddd  \n"
+  u8"cccc |g|aaaaaaaa| --** | SUBTRACT   | --** |bbbbbbbb|v| dddd            PRINTER  \n"
+  u8"cccc |g|aaaaaaaa| -*-- | JUMP       | -*-- |bbbbbbbb|v| dddd    ________________________ \n"
+  u8"cccc |g|aaaaaaaa| -*-* | IF MAX     | -*-* |bbbbbbbb|v| dddd   |                        |\n"
+  u8"cccc |g|aaaaaaaa| -**- | IF MIN     | -**- |bbbbbbbb|v| dddd  (|   |=============[]=|   |)\n"
+  u8"cccc |g|aaaaaaaa| -*** | JRI~<>&VX  | -*** |bbbbbbbb|v| dddd   |__ _ ______________ _ __|\n"
+  u8"cccc |g|aaaaaaaa| *--- | READ *     | *--- |bbbbbbbb|v| dddd    | oooooooooooooooooooo | \n"
+  u8"cccc |g|aaaaaaaa| *--* | WRITE *    | *--* |bbbbbbbb|v| dddd    | oooooooooooooooooooo |\n"
+  u8"cccc |g|aaaaaaaa| *-*- | INC/DEC    | *-*- |bbbbbbbb|v| dddd    | oooooooooooooooooooo | \n"
+  u8"cccc |g|aaaaaaaa| *-** | PRINT      | *-** |bbbbbbbb|v| dddd    | oooooooooooooooooooo |\n"
+  u8"cccc |g|aaaaaaaa| **-- |            | **-- |bbbbbbbb|v| dddd    | oooooooooooooooooooo |\n"
+  u8"cccc |g|aaaaaaaa| **-* | IF NOT MAX | **-* |bbbbbbbb|v| dddd    | oooooooooooooooooooo |\n"
+  u8"cccc |g|aaaaaaaa| ***- | IF NOT MIN | ***- |bbbbbbbb|v| dddd    | oooooooooooooooooooo |\n"
+  u8"     |g|  STOP  | **** |            | **** | IN/OUT |v|         | oooooooooooooooooooo |\n"
+  u8"      ##########        ############        ##########           ###################### \n"
+  u8"       []    [] \\______/ []      [] \\______/ []    [] \\_________/ []                [] \n"
 };
 
 #endif
\ No newline at end of file
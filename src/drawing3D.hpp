@@ -1,530 +1,44 @@
 #ifndef DRAWING_3D_H
 #define DRAWING_3D_H
 
-#include <string>
-#include <vector>
-
-using namespace std;
+#include "view.hpp"
 
 // Automaticaly generated file from resources/drawing textfile.
 // Do not edit this line.
 
-const vector<string> drawing3D = {u8"\u0020", u8"\u2572", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2571", u8"\u000D", 
-u8"\u000A", u8"\u0020", u8"\u0020", u8"\u2572", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2571", u8"\u000D", 
-u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2572", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2571", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2572", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u2571", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0043", u8"\u0050", 
-u8"\u0055", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u256D", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u256E", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0050", u8"\u0043", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0043", u8"\u004F", u8"\u0044", u8"\u0045", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2503", u8"\u0072", u8"\u0072", u8"\u0072", u8"\u0072", 
-u8"\u0072", u8"\u0072", u8"\u0072", u8"\u0072", u8"\u2503", u8"\u0020", 
-u8"\u2502", u8"\u2572", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0044", u8"\u0041", u8"\u0054", u8"\u0041", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0041", u8"\u0044", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u256D", u8"\u2500", u8"\u252C", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u256E", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u251C", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2524", u8"\u0020", u8"\u007C", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u256D", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u252C", 
-u8"\u2500", u8"\u256E", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u2572", u8"\u0020", u8"\u0020", 
-u8"\u00B7", u8"\u00B7", u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0052", u8"\u0045", u8"\u0041", u8"\u0044", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u00B7", 
-u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u0020", u8"\u2571", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u007C", u8"\u0020", u8"\u00B7", u8"\u00B7", u8"\u00B7", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0057", u8"\u0052", 
-u8"\u0049", u8"\u0054", u8"\u0045", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u00B7", u8"\u00B7", u8"\u00B7", u8"\u2737", u8"\u0020", 
-u8"\u007C", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u00B7", u8"\u00B7", u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0041", u8"\u0044", u8"\u0044", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u00B7", 
-u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u00B7", u8"\u2737", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0053", u8"\u0055", 
-u8"\u0042", u8"\u0054", u8"\u0052", u8"\u0041", u8"\u0043", u8"\u0054", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u00B7", u8"\u00B7", u8"\u2737", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0050", u8"\u0052", u8"\u0049", u8"\u004E", 
-u8"\u0054", u8"\u0045", u8"\u0052", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u00B7", u8"\u2737", u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u004A", u8"\u0055", u8"\u004D", u8"\u0050", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u2737", 
-u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u256D", u8"\u2500", u8"\u252C", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u256E", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u2737", u8"\u00B7", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0049", u8"\u0046", 
-u8"\u0020", u8"\u004D", u8"\u0041", u8"\u0058", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u00B7", u8"\u2737", u8"\u00B7", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u256D", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u256E", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u00B7", u8"\u2737", u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0049", u8"\u0046", u8"\u0020", u8"\u004D", u8"\u0049", 
-u8"\u004E", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u2737", 
-u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u2502", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", 
-u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", u8"\u003D", 
-u8"\u003D", u8"\u003D", u8"\u003D", u8"\u005B", u8"\u005D", u8"\u003D", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u00B7", u8"\u2737", u8"\u2737", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u004A", u8"\u0052", 
-u8"\u0049", u8"\u007E", u8"\u003C", u8"\u003E", u8"\u0026", u8"\u0056", 
-u8"\u0058", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u00B7", u8"\u2737", u8"\u2737", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2570", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u256F", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2737", u8"\u00B7", u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0052", u8"\u0045", u8"\u0041", u8"\u0044", u8"\u0020", 
-u8"\u002A", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u00B7", 
-u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u2570", u8"\u252C", u8"\u2534", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u252C", u8"\u2518", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u00B7", u8"\u00B7", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0057", u8"\u0052", 
-u8"\u0049", u8"\u0054", u8"\u0045", u8"\u0020", u8"\u002A", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2737", u8"\u00B7", u8"\u00B7", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2737", u8"\u00B7", u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0049", u8"\u004E", u8"\u0043", u8"\u002F", u8"\u0044", 
-u8"\u0045", u8"\u0043", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u00B7", 
-u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u00B7", u8"\u2737", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0050", u8"\u0052", 
-u8"\u0049", u8"\u004E", u8"\u0054", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2737", u8"\u00B7", u8"\u2737", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2737", u8"\u2737", u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u2737", 
-u8"\u00B7", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u2737", u8"\u00B7", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0049", u8"\u0046", 
-u8"\u0020", u8"\u004E", u8"\u004F", u8"\u0054", u8"\u0020", u8"\u004D", 
-u8"\u0041", u8"\u0058", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2737", u8"\u2737", u8"\u00B7", u8"\u2737", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u2502", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0067", u8"\u2502", 
-u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", u8"\u0061", 
-u8"\u0061", u8"\u0061", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u2737", u8"\u2737", u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", 
-u8"\u0020", u8"\u0049", u8"\u0046", u8"\u0020", u8"\u004E", u8"\u004F", 
-u8"\u0054", u8"\u0020", u8"\u004D", u8"\u0049", u8"\u004E", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2737", u8"\u2737", 
-u8"\u2737", u8"\u00B7", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", 
-u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", u8"\u0062", 
-u8"\u0062", u8"\u0062", u8"\u2502", u8"\u0076", u8"\u2502", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u2502", u8"\u0020", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2502", u8"\u0067", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0053", 
-u8"\u0054", u8"\u004F", u8"\u0050", u8"\u0020", u8"\u0020", u8"\u2502", 
-u8"\u2571", u8"\u2575", u8"\u0020", u8"\u2737", u8"\u2737", u8"\u2737", 
-u8"\u2737", u8"\u0020", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u2571", u8"\u2575", 
-u8"\u0020", u8"\u2737", u8"\u2737", u8"\u2737", u8"\u2737", u8"\u0020", 
-u8"\u2575", u8"\u2572", u8"\u2502", u8"\u0020", u8"\u0049", u8"\u004E", 
-u8"\u002F", u8"\u004F", u8"\u0055", u8"\u0054", u8"\u0020", u8"\u2502", 
-u8"\u0076", u8"\u2502", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2575", 
-u8"\u2572", u8"\u2502", u8"\u0020", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", 
-u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u006F", u8"\u0020", 
-u8"\u2502", u8"\u0020", u8"\u0020", u8"\u2502", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u255E", u8"\u2550", u8"\u2567", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2561", u8"\u2571", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u255E", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2561", u8"\u2571", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2572", u8"\u255E", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2567", u8"\u2550", u8"\u2561", u8"\u2500", 
-u8"\u2500", u8"\u2500", u8"\u2500", u8"\u2572", u8"\u255E", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2561", u8"\u2500", u8"\u2500", 
-u8"\u000D", u8"\u000A", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u2571", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2558", 
-u8"\u2564", u8"\u2564", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2564", u8"\u2564", u8"\u255B", u8"\u2535", 
-u8"\u2508", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u2558", u8"\u2564", u8"\u2564", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2564", u8"\u2564", u8"\u255B", u8"\u2535", u8"\u2508", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2508", 
-u8"\u2504", u8"\u2558", u8"\u2564", u8"\u2564", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2564", u8"\u2564", 
-u8"\u255B", u8"\u2508", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2536", 
-u8"\u2558", u8"\u2550", u8"\u2564", u8"\u2564", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", u8"\u2550", 
-u8"\u2550", u8"\u2550", u8"\u2564", u8"\u2564", u8"\u2550", u8"\u255B", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2572", u8"\u000D", u8"\u000A", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2571", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", u8"\u2536", u8"\u2535", 
-u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", 
-u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", 
-u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", u8"\u2536", u8"\u2535", 
-u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", 
-u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", 
-u8"\u2508", u8"\u2504", u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", 
-u8"\u2508", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", 
-u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2508", u8"\u2504", 
-u8"\u2536", u8"\u2535", u8"\u2504", u8"\u2508", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2572", u8"\u000D", u8"\u000A", u8"\u0020", 
-u8"\u0020", u8"\u2571", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u2572", u8"\u000D", u8"\u000A", u8"\u0020", 
-u8"\u2571", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2572", u8"\u000D", u8"\u000A", 
-u8"\u2571", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", 
-u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u0020", u8"\u2572", 
-u8"\u000D", u8"\u000A"
+const Drawing drawing3D = {
+  31, 102,
+  u8" ╲                                                                                                  ╱\n"
+  u8"  ╲                                                                                                ╱\n"
+  u8"   ╲                                                                                              ╱\n"
+  u8"    ╲                                                                                            ╱\n"
+  u8"      ──────────────────────────────────────────────────────────────────────────────────────────\n"
+  u8"     │                            CPU                                                           │\n"
+  u8"     │                       ╭────────────╮                                                     │\n"
+  u8"     │   PC   CODE           │ ┃rrrrrrrr┃ │╲            DATA   AD                               │\n"
+  u8"     │   ╭─┬────────╮        ├────────────┤ |        ╭────────┬─╮                               │\n"
+  u8"     │   │g│aaaaaaaa│╲  ···· │ READ       │ │ ····  ╱│bbbbbbbb│v│                               │\n"
+  u8"     │   │g│aaaaaaaa│ | ···✷ │ WRITE      │ │ ···✷ | │bbbbbbbb│v│                               │\n"
+  u8"     │   │g│aaaaaaaa│ │ ··✷· │ ADD        │ │ ··✷· │ │bbbbbbbb│v│                               │\n"
+  u8"     │   │g│aaaaaaaa│ │ ··✷✷ │ SUBTRACT   │ │ ··✷✷ │ │bbbbbbbb│v│            PRINTER            │\n"
+  u8"     │   │g│aaaaaaaa│ │ ·✷·· │ JUMP       │ │ ·✷·· │ │bbbbbbbb│v│  ╭─┬────────────────────────╮ │\n"
+  u8"     │   │g│aaaaaaaa│ │ ·✷·✷ │ IF MAX     │ │ ·✷·✷ │ │bbbbbbbb│v│  │ │   ╭────────────────╮   │ │\n"
+  u8"     │   │g│aaaaaaaa│ │ ·✷✷· │ IF MIN     │ │ ·✷✷· │ │bbbbbbbb│v│  │ │   │=============[]=│   │ │\n"
+  u8"     │   │g│aaaaaaaa│ │ ·✷✷✷ │ JRI~<>&VX  │ │ ·✷✷✷ │ │bbbbbbbb│v│  │ │   ╰────────────────╯   │ │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷··· │ READ *     │ │ ✷··· │ │bbbbbbbb│v│  ╰┬┴───────────────────────┬┘ │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷··✷ │ WRITE *    │ │ ✷··✷ │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷·✷· │ INC/DEC    │ │ ✷·✷· │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷·✷✷ │ PRINT      │ │ ✷·✷✷ │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷✷·· │            │ │ ✷✷·· │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷✷·✷ │ IF NOT MAX │ │ ✷✷·✷ │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│aaaaaaaa│ │ ✷✷✷· │ IF NOT MIN │ │ ✷✷✷· │ │bbbbbbbb│v│   │ │ oooooooooooooooooooo │  │\n"
+  u8"     │   │g│  STOP  │╱╵ ✷✷✷✷ │            │╱╵ ✷✷✷✷ ╵╲│ IN/OUT │v│   ╵╲│ oooooooooooooooooooo │  │\n"
+  u8"      ───╞═╧════════╡╱───────╞════════════╡╱────────╲╞════════╧═╡────╲╞══════════════════════╡──\n"
+  u8"    ╱    ╘╤╤══════╤╤╛┵┈      ╘╤╤════════╤╤╛┵┈      ┈┄╘╤╤══════╤╤╛┈  ┈┶╘═╤╤════════════════╤╤═╛   ╲\n"
+  u8"   ╱    ┈┄┶┵┄┈  ┈┄┶┵┄┈      ┈┄┶┵┄┈    ┈┄┶┵┄┈        ┈┄┶┵┄┈  ┈┄┶┵┄┈┈   ┈┄┶┵┄┈            ┈┄┶┵┄┈    ╲\n"
+  u8"  ╱                                                                                                ╲\n"
+  u8" ╱                                                                                                  ╲\n"
+  u8"╱                                                                                                    ╲\n"
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "edit_history.hpp"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "ram.hpp"
+
+using namespace std;
+
+/*
+ * Clears the history. Ram's current state is the one that the first edit
+ * will get compared to.
+ */
+void EditHistory::start(const Ram &ram) {
+  undoStack.clear();
+  redoStack.clear();
+  image = ram.getImage();
+}
+
+/*
+ * Records the words that changed since the last call as a new edit, and
+ * clears the redo history. Does nothing if ram didn't change.
+ */
+void EditHistory::record(const Ram &ram) {
+  RamImage current = ram.getImage();
+  vector<Change> edit;
+  for (size_t i = 0; i < image.size(); i++) {
+    if (image[i] != current[i]) {
+      edit.push_back({ (uint8_t) i, image[i], current[i] });
+    }
+  }
+  if (edit.empty()) {
+    return;
+  }
+  undoStack.push_back(edit);
+  redoStack.clear();
+  image = current;
+}
+
+/*
+ * Returns whether there was anything to undo.
+ */
+bool EditHistory::undo(Ram &ram) {
+  if (undoStack.empty()) {
+    return false;
+  }
+  apply(ram, undoStack.back(), false);
+  redoStack.push_back(undoStack.back());
+  undoStack.pop_back();
+  return true;
+}
+
+/*
+ * Returns whether there was anything to redo.
+ */
+bool EditHistory::redo(Ram &ram) {
+  if (redoStack.empty()) {
+    return false;
+  }
+  apply(ram, redoStack.back(), true);
+  undoStack.push_back(redoStack.back());
+  redoStack.pop_back();
+  return true;
+}
+
+void EditHistory::apply(Ram &ram, const vector<Change> &edit, bool forward) {
+  for (const Change &change : edit) {
+    image[change.index] = forward ? change.after : change.before;
+  }
+  ram.setImage(image);
+}
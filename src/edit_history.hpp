@@ -0,0 +1,38 @@
+#ifndef EDIT_HISTORY_H
+#define EDIT_HISTORY_H
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "ram.hpp"
+
+using namespace std;
+
+/*
+ * Undo and redo history of the edits of the ram. Every edit is stored as
+ * a list of words that it changed, together with their old and new values,
+ * so history only grows by the words that actually changed.
+ */
+class EditHistory {
+  public:
+    void start(const Ram &ram);
+    void record(const Ram &ram);
+    bool undo(Ram &ram);
+    bool redo(Ram &ram);
+
+  private:
+    // Index of the word in the ram image, and its values.
+    struct Change {
+      uint8_t index;
+      uint8_t before;
+      uint8_t after;
+    };
+    vector<vector<Change>> undoStack;
+    vector<vector<Change>> redoStack;
+    // State of the ram after the last recorded, undone or redone edit.
+    RamImage image;
+    void apply(Ram &ram, const vector<Change> &edit, bool forward);
+};
+
+#endif
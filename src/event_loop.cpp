@@ -0,0 +1,299 @@
+#include "event_loop.hpp"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "output.hpp"
+
+using namespace std;
+
+/*
+ * Waits on stdin, the signals and the wake ups from other threads at the
+ * same time, so that keys get processed as soon as they are pressed, while
+ * the machine keeps running in its own thread.
+ */
+
+////// PRIVATE ///////
+
+int createSignalFd();
+int createEventFd();
+Event readSignal();
+Event readWakeUp();
+Event readKey(char &key);
+Event replayBurst(char &key);
+void recordBurst(const char *keys, size_t size);
+
+////////////////////////////
+
+enum { STDIN_POLL, SIGNAL_POLL, WAKE_POLL, NUM_OF_POLLS };
+
+struct pollfd polls[NUM_OF_POLLS];
+
+/*
+ * Keys get read from stdin in bursts, all that are available at once, and
+ * then returned one by one. This way editor can tell if more keys are
+ * coming (held key, paste) and redraw only after the last one.
+ */
+#define KEY_BUFFER_SIZE 256
+char keyBuffer[KEY_BUFFER_SIZE];
+ssize_t keysRead = 0;
+ssize_t keysReturned = 0;
+
+/*
+ * Bursts of keys can be recorded into a file, and replayed from it instead
+ * of stdin. Every burst is a line with milliseconds since the start of the
+ * recording, the stamp (cycle of the running machine, or zero if it isn't
+ * running) and the values of the keys. Burst without keys stands for
+ * ctrl-c. Replay ignores the time, and returns the burst as soon as
+ * machine reaches its stamp, so it runs at full speed, while keys still
+ * reach the machine at the same cycles.
+ */
+struct Burst {
+  long stamp;
+  string keys;
+};
+FILE *recordFile = NULL;
+chrono::steady_clock::time_point recordingStart;
+bool replaying = false;
+vector<Burst> bursts;
+size_t nextBurst = 0;
+stamp_function getKeyStamp = NULL;
+
+/////////////////////////////
+////////// PUBLIC ///////////
+/////////////////////////////
+
+/*
+ * Blocks SIGINT and SIGWINCH, so they get delivered through the signalfd
+ * instead of to their handlers. Must be called before any thread is
+ * started, so that the threads inherit the mask.
+ */
+void initEventLoop() {
+  polls[STDIN_POLL] = { STDIN_FILENO, POLLIN, 0 };
+  polls[SIGNAL_POLL] = { createSignalFd(), POLLIN, 0 };
+  polls[WAKE_POLL] = { createEventFd(), POLLIN, 0 };
+}
+
+/*
+ * Can be called from any thread. Wake ups that happen before the loop
+ * gets to them are merged into a single event.
+ */
+void wakeEventLoop() {
+  uint64_t one = 1;
+  if (write(polls[WAKE_POLL].fd, &one, sizeof(one)) == -1) {
+    perror("Could not wake event loop");
+  }
+}
+
+/*
+ * Returns the next event, or NO_EVENT if there is none after the timeout
+ * (in milliseconds, or -1 to wait indefinitely). Signals take precedence
+ * over keys, and keys over the wake ups. Keys that were already read get
+ * returned without waiting.
+ */
+Event waitForEvent(int timeout, char &key) {
+  if (keysPending()) {
+    key = keyBuffer[keysReturned++];
+    return KEY_EVENT;
+  }
+  if (replaying && keysDue()) {
+    return replayBurst(key);
+  }
+  int ready = poll(polls, NUM_OF_POLLS, timeout);
+  if (ready == -1 && errno == EINTR) {
+    return waitForEvent(timeout, key);
+  }
+  if (ready <= 0) {
+    return NO_EVENT;
+  }
+  if (polls[SIGNAL_POLL].revents) {
+    return readSignal();
+  }
+  if (polls[STDIN_POLL].revents) {
+    return readKey(key);
+  }
+  if (polls[WAKE_POLL].revents) {
+    return readWakeUp();
+  }
+  return NO_EVENT;
+}
+
+/*
+ * Whether the next key is already read, i.e. the last key was not the
+ * last one of its burst.
+ */
+bool keysPending() {
+  return keysReturned < keysRead;
+}
+
+void startRecordingKeys(const char *filename, stamp_function getStamp) {
+  recordFile = fopen(filename, "w");
+  if (recordFile == NULL) {
+    perror("Could not open file for recording keys");
+    exit(EXIT_FAILURE);
+  }
+  recordingStart = chrono::steady_clock::now();
+  getKeyStamp = getStamp;
+}
+
+/*
+ * Reads all bursts from the file, and stops polling stdin. Must be called
+ * after 'initEventLoop()'.
+ */
+void startReplayingKeys(const char *filename, stamp_function getStamp) {
+  ifstream file(filename);
+  if (!file) {
+    fprintf(stderr, "Could not open file with recorded keys %s.\n",
+            filename);
+    exit(EXIT_FAILURE);
+  }
+  string line;
+  while (getline(file, line)) {
+    istringstream fields(line);
+    long millis;
+    Burst burst;
+    if (!(fields >> millis >> burst.stamp)) {
+      continue;
+    }
+    int value;
+    while (fields >> value) {
+      burst.keys += (char) value;
+    }
+    bursts.push_back(burst);
+  }
+  polls[STDIN_POLL].fd = -1;
+  replaying = true;
+  getKeyStamp = getStamp;
+}
+
+bool replayingKeys() {
+  return replaying;
+}
+
+/*
+ * Whether the next recorded burst should be returned. Burst that was
+ * recorded while machine was running is due when machine reaches its
+ * stamp, and the rest when it stops running. End of the recording is
+ * always due.
+ */
+bool keysDue() {
+  if (nextBurst >= bursts.size()) {
+    return true;
+  }
+  long stamp = getKeyStamp();
+  long burstStamp = bursts[nextBurst].stamp;
+  return stamp == 0 || (burstStamp != 0 && burstStamp <= stamp);
+}
+
+/////////////////////////////
+////////// PRIVATE //////////
+/////////////////////////////
+
+int createSignalFd() {
+  sigset_t set;
+  sigemptyset(&set);
+  sigaddset(&set, SIGINT);
+  sigaddset(&set, SIGWINCH);
+  sigprocmask(SIG_BLOCK, &set, NULL);
+  int fd = signalfd(-1, &set, SFD_CLOEXEC);
+  if (fd == -1) {
+    perror("Could not create signalfd");
+    exit(EXIT_FAILURE);
+  }
+  return fd;
+}
+
+int createEventFd() {
+  int fd = eventfd(0, EFD_CLOEXEC);
+  if (fd == -1) {
+    perror("Could not create eventfd");
+    exit(EXIT_FAILURE);
+  }
+  return fd;
+}
+
+/*
+ * Resize also sets the flag, so that output updates the console size on
+ * next redraw.
+ */
+Event readSignal() {
+  struct signalfd_siginfo info;
+  if (read(polls[SIGNAL_POLL].fd, &info, sizeof(info)) != sizeof(info)) {
+    return NO_EVENT;
+  }
+  if (info.ssi_signo == SIGINT) {
+    recordBurst(NULL, 0);
+    return QUIT_EVENT;
+  }
+  screenResized = 1;
+  return RESIZE_EVENT;
+}
+
+Event readWakeUp() {
+  uint64_t count;
+  if (read(polls[WAKE_POLL].fd, &count, sizeof(count)) == -1) {
+    return NO_EVENT;
+  }
+  return WAKE_EVENT;
+}
+
+/*
+ * Reads all available bytes and returns the first one. Rest of them
+ * (including the rest of an escape sequence) gets returned by the
+ * following calls. At the end of input key is zero.
+ */
+Event readKey(char &key) {
+  keysRead = read(STDIN_FILENO, keyBuffer, KEY_BUFFER_SIZE);
+  keysReturned = 0;
+  if (keysRead <= 0) {
+    keysRead = 0;
+    key = 0;
+    return KEY_EVENT;
+  }
+  recordBurst(keyBuffer, keysRead);
+  key = keyBuffer[keysReturned++];
+  return KEY_EVENT;
+}
+
+/*
+ * Returns quit event at the end of the recording, or if the burst is
+ * ctrl-c.
+ */
+Event replayBurst(char &key) {
+  if (nextBurst >= bursts.size() || bursts[nextBurst].keys.empty()) {
+    return QUIT_EVENT;
+  }
+  const string &keys = bursts[nextBurst++].keys;
+  keysRead = min(keys.size(), (size_t) KEY_BUFFER_SIZE);
+  keys.copy(keyBuffer, keysRead);
+  keysReturned = 0;
+  key = keyBuffer[keysReturned++];
+  return KEY_EVENT;
+}
+
+void recordBurst(const char *keys, size_t size) {
+  if (recordFile == NULL) {
+    return;
+  }
+  chrono::milliseconds millis = chrono::duration_cast<chrono::milliseconds>(
+      chrono::steady_clock::now() - recordingStart);
+  fprintf(recordFile, "%ld %ld", (long) millis.count(), getKeyStamp());
+  for (size_t i = 0; i < size; i++) {
+    fprintf(recordFile, " %d", (unsigned char) keys[i]);
+  }
+  fprintf(recordFile, "\n");
+  fflush(recordFile);
+}
@@ -0,0 +1,19 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+using namespace std;
+
+enum Event { NO_EVENT, KEY_EVENT, WAKE_EVENT, RESIZE_EVENT, QUIT_EVENT };
+
+typedef long (*stamp_function)(void);
+
+void initEventLoop();
+void wakeEventLoop();
+Event waitForEvent(int timeout, char &key);
+bool keysPending();
+void startRecordingKeys(const char *filename, stamp_function getStamp);
+void startReplayingKeys(const char *filename, stamp_function getStamp);
+bool replayingKeys();
+bool keysDue();
+ 
+#endif
@@ -0,0 +1,161 @@
+#include "execution_log.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "const.hpp"
+#include "fast_cpu.hpp"
+
+using namespace std;
+
+/*
+ * Clears the log, so the next recorded cycle must pass the whole data.
+ * Rings get allocated on first execution, so modes that don't use the log
+ * don't pay for them.
+ */
+void ExecutionLog::start(long cycle) {
+  deltas.resize(EXECUTION_LOG_CYCLES);
+  keyframes.resize(EXECUTION_LOG_CYCLES / EXECUTION_LOG_KEYFRAME_INTERVAL);
+  firstCycle = cycle;
+  lastCycle = cycle - 1;
+  hasData = false;
+  lastPrinted = false;
+  writtenAdr = RAM_SIZE;
+  outputs = 0;
+}
+
+/*
+ * Gets called before the cycle gets executed, with the state at that
+ * cycle, and stores what the previous cycle changed. Instruction can
+ * change at most one data word. Data can be NULL if the previous cycle
+ * reported its write with 'recordWrite()' (see 'needsData()'). Recording
+ * the same cycle again does nothing, and if cycles were skipped (executed
+ * without the log), log starts again.
+ */
+void ExecutionLog::record(long cycle, uint8_t pc, uint8_t reg,
+                          const uint8_t *data) {
+  if (cycle == lastCycle) {
+    return;
+  }
+  if (needsData(cycle)) {
+    start(cycle);
+    memcpy(last.data, data, RAM_SIZE);
+    hasData = true;
+  } else {
+    Delta &delta = deltas[lastCycle % deltas.size()];
+    delta.pc = last.pc;
+    delta.reg = last.reg;
+    delta.adr = RAM_SIZE;
+    delta.printed = lastPrinted;
+    if (data == NULL) {
+      if (writtenAdr < RAM_SIZE) {
+        delta.adr = writtenAdr;
+        delta.word = last.data[writtenAdr];
+        last.data[writtenAdr] = writtenWord;
+      }
+    } else {
+      for (int i = 0; i < RAM_SIZE; i++) {
+        if (data[i] != last.data[i]) {
+          delta.adr = i;
+          delta.word = last.data[i];
+        }
+      }
+      memcpy(last.data, data, RAM_SIZE);
+    }
+  }
+  writtenAdr = RAM_SIZE;
+  last.pc = pc;
+  last.reg = reg;
+  last.outputs = outputs;
+  lastPrinted = false;
+  if (cycle % EXECUTION_LOG_KEYFRAME_INTERVAL == 0) {
+    keyframes[(cycle / EXECUTION_LOG_KEYFRAME_INTERVAL) % keyframes.size()] =
+        last;
+  }
+  lastCycle = cycle;
+}
+
+/*
+ * Whether recording of the cycle starts the log again, so it must be passed
+ * the whole data.
+ */
+bool ExecutionLog::needsData(long cycle) const {
+  return !hasData || cycle != lastCycle + 1;
+}
+
+/*
+ * Gets called if the last recorded cycle wrote a data word, with its new
+ * value.
+ */
+void ExecutionLog::recordWrite(int adr, uint8_t word) {
+  writtenAdr = adr;
+  writtenWord = word;
+}
+
+/*
+ * Gets called if the last recorded cycle printed a word.
+ */
+void ExecutionLog::recordOutput() {
+  lastPrinted = true;
+  outputs++;
+}
+
+/*
+ * Earliest cycle that the state at the present cycle can be rewound to.
+ * Present state must be the last recorded one, or the one right after it,
+ * and log must hold all the cycles in between, and the first keyframe
+ * after the cycle.
+ */
+long ExecutionLog::getFirstCycle(long presentCycle) const {
+  bool upToDate = lastCycle == presentCycle || lastCycle == presentCycle - 1;
+  if (deltas.empty() || !upToDate) {
+    return presentCycle;
+  }
+  long oldest = lastCycle - (long) deltas.size() +
+                EXECUTION_LOG_KEYFRAME_INTERVAL;
+  return min(max(firstCycle, oldest), presentCycle);
+}
+
+bool ExecutionLog::canRewind(long presentCycle, long cycle) const {
+  return cycle <= presentCycle && cycle >= getFirstCycle(presentCycle);
+}
+
+/*
+ * Turns the passed state, that must be the present one (see
+ * 'canRewind()'), into the state at the passed cycle. Returns the number
+ * of words that were printed since then.
+ */
+size_t ExecutionLog::rewind(FastCpu &cpu, long cycle) const {
+  if (cycle == cpu.cycle) {
+    return 0;
+  }
+  State state = last;
+  long from = lastCycle;
+  long keyframeCycle = (cycle + EXECUTION_LOG_KEYFRAME_INTERVAL - 1) /
+                       EXECUTION_LOG_KEYFRAME_INTERVAL *
+                       EXECUTION_LOG_KEYFRAME_INTERVAL;
+  if (keyframeCycle < from) {
+    state = keyframes[(keyframeCycle / EXECUTION_LOG_KEYFRAME_INTERVAL) %
+                      keyframes.size()];
+    from = keyframeCycle;
+  }
+  for (long i = from - 1; i >= cycle; i--) {
+    const Delta &delta = deltas[i % deltas.size()];
+    state.pc = delta.pc;
+    state.reg = delta.reg;
+    if (delta.adr < RAM_SIZE) {
+      state.data[delta.adr] = delta.word;
+    }
+    if (delta.printed) {
+      state.outputs--;
+    }
+  }
+  memcpy(cpu.data, state.data, RAM_SIZE);
+  cpu.pc = state.pc;
+  cpu.reg = state.reg;
+  cpu.cycle = cycle;
+  return outputs - state.outputs;
+}
@@ -0,0 +1,70 @@
+#ifndef EXECUTION_LOG_H
+#define EXECUTION_LOG_H
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "const.hpp"
+
+using namespace std;
+
+class FastCpu;
+
+/*
+ * Log of the last executed cycles, that the state of the machine can be
+ * rewound with. It works on the state in bytes (as kept by the fast cpu),
+ * so it is used by the interactive mode as well as by the debugger. Every
+ * cycle only stores what it changed (previous pc, register and value of the
+ * data word it changed, and whether it printed), and every
+ * EXECUTION_LOG_KEYFRAME_INTERVAL cycles the whole state gets stored as a
+ * keyframe. Rewinding starts at the first keyframe after the wanted cycle
+ * (or at the last recorded state), so it undoes at most that many cycles.
+ */
+class ExecutionLog {
+  public:
+    void start(long cycle);
+    void record(long cycle, uint8_t pc, uint8_t reg, const uint8_t *data);
+    bool needsData(long cycle) const;
+    void recordWrite(int adr, uint8_t word);
+    void recordOutput();
+    long getFirstCycle(long presentCycle) const;
+    bool canRewind(long presentCycle, long cycle) const;
+    size_t rewind(FastCpu &cpu, long cycle) const;
+
+  private:
+    // What the cycle changed. Address is RAM_SIZE if no data word changed.
+    struct Delta {
+      uint8_t pc : 4;
+      uint8_t adr : 4;
+      uint8_t reg;
+      uint8_t word;
+      bool printed;
+    };
+    struct State {
+      uint8_t data[RAM_SIZE];
+      uint8_t pc;
+      uint8_t reg;
+      // Number of words printed before this cycle.
+      size_t outputs;
+    };
+    // Both are rings, indexed by cycle.
+    vector<Delta> deltas;
+    vector<State> keyframes;
+    long firstCycle = 0;
+    long lastCycle = -1;
+    // State at the last recorded cycle, that the delta of the cycle gets
+    // computed from when the next one is recorded.
+    State last;
+    // Whether 'last' holds the data. Log started from the outside doesn't
+    // have it until the first cycle gets recorded with the whole data.
+    bool hasData = false;
+    bool lastPrinted = false;
+    // Data word that the last recorded cycle wrote, if it was reported with
+    // 'recordWrite()'. Address is RAM_SIZE if it didn't write one.
+    int writtenAdr = RAM_SIZE;
+    uint8_t writtenWord = 0;
+    size_t outputs = 0;
+};
+
+#endif
@@ -0,0 +1,329 @@
+#include "fast_cpu.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "addr_space.hpp"
+#include "const.hpp"
+#include "cpu.hpp"
+#include "debugger.hpp"
+#include "decode_table.hpp"
+#include "provides_output.hpp"
+#include "ram.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+const char * const FastCpu::FUSION_NAMES[NUM_OF_FUSIONS] = {
+  "", "READ ADD WRITE", "READ SUB WRITE", "READ WRITE", "DEC IF NOT MIN"
+};
+
+bool FastCpu::fusionStats = false;
+long FastCpu::fusionHits[NUM_OF_FUSIONS] = { };
+
+/*
+ * Copies state of the ram and cpu.
+ */
+void FastCpu::load(Ram &ram, const Cpu &cpu) {
+  for (int i = 0; i < RAM_SIZE; i++) {
+    code[i] = Util::getInt(ram.state[CODE][i]);
+    data[i] = Util::getInt(ram.state[DATA][i]);
+  }
+  reg = Util::getInt(cpu.getRegister());
+  pc = Util::getInt(cpu.getPc());
+  cycle = cpu.getCycle();
+  input = ram.input;
+  fuse();
+}
+
+/*
+ * Copies data, register and pc back to the ram and cpu.
+ */
+void FastCpu::store(Ram &ram, Cpu &cpu) const {
+  for (int i = 0; i < RAM_SIZE; i++) {
+    ram.state[DATA][i] = Util::getBoolByte(data[i]);
+  }
+  cpu.setRegister(Util::getBoolByte(reg));
+  cpu.setPc(Util::getBoolNibb(pc));
+}
+
+/*
+ * Executes instructions until one of them writes to the output, and returns
+ * the written value. Returns END if last address is reached, or PAUSED if
+ * no output was written in 'maxCycles' cycles. Breakpoints get checked and
+ * fused instructions counted by separate instantiations of the loop, so
+ * runs without a debugger and stats don't pay for them.
+ */
+int FastCpu::run(long maxCycles) {
+  if (debugger != NULL) {
+    return runCycles<true, false>(maxCycles);
+  }
+  if (fusionStats) {
+    return runCycles<false, true>(maxCycles);
+  }
+  return runCycles<false, false>(maxCycles);
+}
+
+/*
+ * When debugging, instructions don't get fused, so breakpoints can be
+ * checked before each of them. They also get checked once more when the
+ * last address is reached, so the hits caused by the last instruction get
+ * reported.
+ */
+template<bool debug, bool countFusions>
+int FastCpu::runCycles(long maxCycles) {
+  long lastCycle = cycle + maxCycles;
+  while (cycle < lastCycle) {
+    if (debug) {
+      debugger->record(*this);
+      if (debugger->shouldStop(*this)) {
+        debugger->stop(*this);
+      }
+    }
+    if (pc >= RAM_SIZE) {
+      return END;
+    }
+    const FusedInstruction &fusedInst = fused[pc];
+    bool fits = lastCycle - cycle >= fusedInst.length;
+    if (!debug && fusedInst.fusion != NO_FUSION && fits) {
+      int out = runFused<countFusions>(fusedInst);
+      if (out != NO_OUTPUT) {
+        return out;
+      }
+      continue;
+    }
+    cycle++;
+    const DecodedInstruction &inst = DECODE_TABLE[code[pc]];
+    int adr = inst.adr;
+    switch (inst.opcode) {
+      case READ:
+        reg = get(adr);
+        pc++;
+        break;
+      case WRITE:
+        pc++;
+        if (adr == RAM_SIZE) {
+          return reg;
+        }
+        data[adr] = reg;
+        break;
+      case ADD: {
+        int sum = reg + get(adr);
+        reg = sum > MAX_VALUE ? MAX_VALUE : sum;
+        pc++;
+        break;
+      }
+      case SUB: {
+        int diff = reg - get(adr);
+        reg = diff < 0 ? 0 : diff;
+        pc++;
+        break;
+      }
+      case JUMP:
+        pc = adr;
+        break;
+      case IF_MAX:
+        pc = reg == MAX_VALUE ? adr : pc + 1;
+        break;
+      case IF_MIN:
+        pc = reg == 0 ? adr : pc + 1;
+        break;
+      case JUMP_REG:
+        pc = reg & 0x0f;
+        break;
+      case READ_REG:
+        reg = get(reg & 0x0f);
+        pc++;
+        break;
+      case INIT:
+        data[adr] = data[INIT_OPERAND_INDEX];
+        reg = data[adr];
+        pc++;
+        break;
+      case NOT:
+        reg = ~reg;
+        pc++;
+        break;
+      case SHIFT_LEFT:
+        reg <<= 1;
+        pc++;
+        break;
+      case SHIFT_RIGHT:
+        reg >>= 1;
+        pc++;
+        break;
+      case AND:
+        reg &= data[adr];
+        pc++;
+        break;
+      case OR:
+        reg |= data[adr];
+        pc++;
+        break;
+      case XOR:
+        reg ^= data[adr];
+        pc++;
+        break;
+      case READ_POINTER:
+        reg = get(get(adr) & 0x0f);
+        pc++;
+        break;
+      case WRITE_POINTER: {
+        int pointer = get(adr) & 0x0f;
+        pc++;
+        if (pointer == RAM_SIZE) {
+          return reg;
+        }
+        data[pointer] = reg;
+        break;
+      }
+      case INCREASE:
+        reg = ++data[adr];
+        pc++;
+        break;
+      case DECREASE:
+        reg = --data[adr];
+        pc++;
+        break;
+      case PRINT: {
+        unsigned char value = get(adr);
+        pc++;
+        return value;
+      }
+      case IF_NOT_MAX:
+        pc = reg == MAX_VALUE ? pc + 1 : adr;
+        break;
+      case IF_NOT_MIN:
+        pc = reg == 0 ? pc + 1 : adr;
+        break;
+      default:
+        break;
+    }
+  }
+  return PAUSED;
+}
+
+/*
+ * Fused instructions get counted from now on, and the counts get printed
+ * at exit.
+ */
+void FastCpu::enableFusionStats() {
+  fusionStats = true;
+  atexit(printFusionStats);
+}
+
+/*
+ * Prints how many times each fused instruction was executed to stderr.
+ */
+void FastCpu::printFusionStats() {
+  for (int i = NO_FUSION + 1; i < NUM_OF_FUSIONS; i++) {
+    fprintf(stderr, "%-16s%ld\n", FUSION_NAMES[i], fusionHits[i]);
+  }
+}
+
+/*
+ * Finds sequences of instructions that can be executed as one, and stores
+ * them at the address of their first instruction. Longer sequences have
+ * precedence. Last instruction of a sequence can be the only one that
+ * writes to the output or jumps.
+ */
+void FastCpu::fuse() {
+  for (int i = 0; i < RAM_SIZE; i++) {
+    Opcode a = getOpcode(i);
+    Opcode b = getOpcode(i+1);
+    Opcode c = getOpcode(i+2);
+    fused[i] = { NO_FUSION, 1, { getAdr(i), getAdr(i+1), getAdr(i+2) } };
+    if (a == READ && b == ADD && c == WRITE) {
+      fused[i].fusion = READ_ADD_WRITE;
+      fused[i].length = 3;
+    } else if (a == READ && b == SUB && c == WRITE) {
+      fused[i].fusion = READ_SUB_WRITE;
+      fused[i].length = 3;
+    } else if (a == READ && b == WRITE) {
+      fused[i].fusion = READ_WRITE;
+      fused[i].length = 2;
+    } else if (a == DECREASE && b == IF_NOT_MIN) {
+      fused[i].fusion = DEC_IF_NOT_MIN;
+      fused[i].length = 2;
+    }
+  }
+}
+
+/*
+ * Addresses past the end of the code don't belong to any sequence.
+ */
+Opcode FastCpu::getOpcode(int pcIn) const {
+  if (pcIn >= RAM_SIZE) {
+    return NUM_OF_OPCODES;
+  }
+  return DECODE_TABLE[code[pcIn]].opcode;
+}
+
+unsigned char FastCpu::getAdr(int pcIn) const {
+  if (pcIn >= RAM_SIZE) {
+    return 0;
+  }
+  return DECODE_TABLE[code[pcIn]].adr;
+}
+
+/*
+ * Executes fused instruction and returns the written value, or NO_OUTPUT.
+ */
+template<bool countFusions>
+int FastCpu::runFused(const FusedInstruction &inst) {
+  if (countFusions) {
+    fusionHits[inst.fusion]++;
+  }
+  cycle += inst.length;
+  switch (inst.fusion) {
+    case READ_ADD_WRITE: {
+      reg = get(inst.adr[0]);
+      int sum = reg + get(inst.adr[1]);
+      reg = sum > MAX_VALUE ? MAX_VALUE : sum;
+      pc += 3;
+      if (inst.adr[2] == RAM_SIZE) {
+        return reg;
+      }
+      data[inst.adr[2]] = reg;
+      return NO_OUTPUT;
+    }
+    case READ_SUB_WRITE: {
+      reg = get(inst.adr[0]);
+      int diff = reg - get(inst.adr[1]);
+      reg = diff < 0 ? 0 : diff;
+      pc += 3;
+      if (inst.adr[2] == RAM_SIZE) {
+        return reg;
+      }
+      data[inst.adr[2]] = reg;
+      return NO_OUTPUT;
+    }
+    case READ_WRITE:
+      reg = get(inst.adr[0]);
+      pc += 2;
+      if (inst.adr[1] == RAM_SIZE) {
+        return reg;
+      }
+      data[inst.adr[1]] = reg;
+      return NO_OUTPUT;
+    case DEC_IF_NOT_MIN:
+      reg = --data[inst.adr[0]];
+      pc = reg == 0 ? pc + 2 : inst.adr[1];
+      return NO_OUTPUT;
+    default:
+      return NO_OUTPUT;
+  }
+}
+
+/*
+ * Reads from the data part of the ram, or from the input if address is
+ * the last one.
+ */
+unsigned char FastCpu::get(int adr) {
+  if (adr == RAM_SIZE) {
+    return Util::getInt(input->getOutput());
+  }
+  return data[adr];
+}
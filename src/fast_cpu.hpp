@@ -0,0 +1,72 @@
+#ifndef FAST_CPU_H
+#define FAST_CPU_H
+
+#include "const.hpp"
+#include "decode_table.hpp"
+
+using namespace std;
+
+class Cpu;
+class Debugger;
+class ProvidesOutput;
+class Ram;
+
+/*
+ * Interpreter that keeps the state in bytes instead of vectors of bools,
+ * and doesn't create new instruction object for every executed instruction.
+ * It must behave exactly the same as Cpu, so that execution can switch
+ * from one to the other at any time.
+ *
+ * Common sequences of two or three instructions get executed as a single
+ * fused instruction (see fuse()). They are entered only through their
+ * first address, so jumps into the middle of a sequence still work.
+ */
+class FastCpu {
+  public:
+    // Returned by run() when execution reaches the last address.
+    static const int END = -1;
+    // Returned by run() when it executes the specified number of cycles.
+    static const int PAUSED = -2;
+
+    void load(Ram &ram, const Cpu &cpu);
+    void store(Ram &ram, Cpu &cpu) const;
+    int run(long maxCycles);
+    static void enableFusionStats();
+    static void printFusionStats();
+
+    unsigned char code[RAM_SIZE] = { };
+    unsigned char data[RAM_SIZE] = { };
+    unsigned char reg = 0;
+    unsigned char pc = 0;
+    long cycle = 0;
+    ProvidesOutput *input = NULL;
+    // If set, breakpoints get checked before every instruction.
+    Debugger *debugger = NULL;
+
+  private:
+    // Returned by runFused() when instructions didn't write to the output.
+    static const int NO_OUTPUT = -3;
+    enum Fusion { NO_FUSION, READ_ADD_WRITE, READ_SUB_WRITE, READ_WRITE,
+                  DEC_IF_NOT_MIN, NUM_OF_FUSIONS };
+    struct FusedInstruction {
+      Fusion fusion;
+      int length;
+      unsigned char adr[3];
+    };
+    static const char * const FUSION_NAMES[NUM_OF_FUSIONS];
+    // How many times each fused instruction was executed, by all cpus.
+    // Only counted if stats are enabled.
+    static bool fusionStats;
+    static long fusionHits[NUM_OF_FUSIONS];
+
+    FusedInstruction fused[RAM_SIZE] = { };
+
+    template<bool debug, bool countFusions> int runCycles(long maxCycles);
+    void fuse();
+    Opcode getOpcode(int pcIn) const;
+    unsigned char getAdr(int pcIn) const;
+    template<bool countFusions> int runFused(const FusedInstruction &inst);
+    unsigned char get(int adr);
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "glyph.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+ * Tables are function statics, so they can be used during static
+ * initialization.
+ */
+vector<string> &getStrings() {
+  static vector<string> strings = { " " };
+  return strings;
+}
+
+map<string, Glyph> &getIds() {
+  static map<string, Glyph> ids = { { " ", SPACE_GLYPH } };
+  return ids;
+}
+
+Glyph GlyphTable::getGlyph(const string &character) {
+  map<string, Glyph> &ids = getIds();
+  auto it = ids.find(character);
+  if (it != ids.end()) {
+    return it->second;
+  }
+  vector<string> &strings = getStrings();
+  Glyph glyph = strings.size();
+  strings.push_back(character);
+  ids[character] = glyph;
+  return glyph;
+}
+
+/*
+ * Ascii characters get looked up in an array, since the printer's output
+ * gets converted every frame.
+ */
+Glyph GlyphTable::getGlyph(char character) {
+  static Glyph asciiGlyphs[128] = { };
+  static bool asciiInterned[128] = { };
+  unsigned char c = character;
+  if (c >= 128) {
+    return getGlyph(string(1, character));
+  }
+  if (!asciiInterned[c]) {
+    asciiGlyphs[c] = getGlyph(string(1, character));
+    asciiInterned[c] = true;
+  }
+  return asciiGlyphs[c];
+}
+
+const string &GlyphTable::getString(Glyph glyph) {
+  return getStrings()[glyph];
+}
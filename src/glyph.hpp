@@ -0,0 +1,46 @@
+#ifndef GLYPH_H
+#define GLYPH_H
+
+#include <stdint.h>
+
+#include <string>
+
+using namespace std;
+
+/*
+ * Characters of the drawing get interned, so the renderer and the output
+ * can pass them around and compare them as numbers. They get converted
+ * back to bytes only when they are written to the terminal. Glyph with
+ * id 0 is space.
+ */
+typedef uint16_t Glyph;
+
+const Glyph SPACE_GLYPH = 0;
+
+const uint8_t HIGHLIGHTED = 1;
+const uint8_t BRIGHT = 2;
+// Heat level of the lightbulb (0-3), when heatmap is shown.
+const uint8_t HEAT = 12;
+const int HEAT_SHIFT = 2;
+
+/*
+ * Character of the picture, together with its attributes.
+ */
+struct Cell {
+  Glyph glyph;
+  uint8_t attrs;
+  bool operator != (const Cell &other) const {
+    return glyph != other.glyph || attrs != other.attrs;
+  }
+};
+
+const Cell EMPTY_CELL = { SPACE_GLYPH, 0 };
+
+class GlyphTable {
+  public:
+    static Glyph getGlyph(const string &character);
+    static Glyph getGlyph(char character);
+    static const string &getString(Glyph glyph);
+};
+
+#endif
@@ -71,8 +71,16 @@ vector<Instruction> Instruction::removeElementsPastIndex(
 /// PRIVATE ///
 ///////////////
 
-vector<Address> Instruction::getFirstOrderAdr(vector<bool> val) {
-  return inst->getFirstOrderAdr(val);
+/*
+ * Init instruction also reads from the INIT_OPERAND_INDEX address.
+ */
+vector<Address> Instruction::getFirstOrderAdr() {
+  vector<Address> out = { Address(decoded.space,
+                                  Util::getBoolNibb(decoded.adr)) };
+  if (decoded.opcode == INIT) {
+    out.push_back(Address(DATA, Util::getBoolNibb(INIT_OPERAND_INDEX)));
+  }
+  return out;
 }
 
 Address Instruction::getAddress(Address firstOrderAdr, const vector<bool> &reg,
@@ -80,74 +88,17 @@ Address Instruction::getAddress(Address firstOrderAdr, const vector<bool> &reg,
   return inst->getAddress(firstOrderAdr, reg, ram);
 }
 
+/*
+ * Specific instructions don't have any state, so all instructions with the
+ * same opcode share one object.
+ */
 SpecificInstruction * Instruction::getInstruction() {
-  switch (index) {
-    case 0:
-      return new Read;
-    case 1:
-      return new Write;
-    case 2:
-      return new Add;
-    case 3:
-      return new Sub;
-    case 4:
-      return new Jump;
-    case 5:
-      return new IfMax;
-    case 6:
-      return new IfMin;
-    case 7:
-      return getLogicInstruction();
-    case 8:
-      return new ReadPointer;
-    case 9:
-      return new WritePointer;
-    case 10: {
-      if (val[4] == false) {
-        return new Increase;
-      } else {
-        return new Decrease;
-      }
-    }
-    case 11:
-      return new Print;
-    case 13:
-      return new IfNotMax;
-    case 14:
-      return new IfNotMin;
-    default:
-      return new Read;
-  }
-}
-
-SpecificInstruction * Instruction::getLogicInstruction() {
-  switch (logicIndex) {
-    case 0:
-      return new JumpReg;
-    case 1:
-      return new ReadReg;
-    case 2:
-      return new InitializeFirstAddress;
-    case 3:
-      return new Not;
-    case 4:
-      return new ShiftLeft;
-    case 5:
-      return new ShiftRight;
-    case 6:
-      return new And;
-    case 7:
-      return new Or;
-    case 8:
-    case 9:
-    case 10:
-    case 11:
-    case 12:
-    case 13:
-    case 14:
-    case 15: 
-      return new Xor;
-    default:
-      return new Read;
-  }
+  static SpecificInstruction * const instructions[NUM_OF_OPCODES] = {
+    new Read, new Write, new Add, new Sub, new Jump, new IfMax, new IfMin,
+    new JumpReg, new ReadReg, new InitializeFirstAddress, new Not,
+    new ShiftLeft, new ShiftRight, new And, new Or, new Xor, new ReadPointer,
+    new WritePointer, new Increase, new Decrease, new Print, new IfNotMax,
+    new IfNotMin
+  };
+  return instructions[decoded.opcode];
 }
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "address.hpp"
+#include "decode_table.hpp"
 #include "specific_instruction.hpp"
 #include "util.hpp"
 
@@ -22,10 +23,11 @@ class Instruction {
         : val(valIn),
           index(Util::getInt(Util::getFirstNibble(valIn))),
           logicIndex(Util::getInt(Util::getSecondNibble(valIn))),
+          decoded(DECODE_TABLE[Util::getInt(valIn)]),
           inst(getInstruction()),
-          firstOrderAdr(getFirstOrderAdr(valIn)),
+          firstOrderAdr(getFirstOrderAdr()),
           adr(getAddress(firstOrderAdr[0], regIn, ramIn)),
-          label(inst->getLabel()) { }
+          label(decoded.label) { }
 
     bool operator == (const Instruction &other) const {
       return val == other.val;
@@ -34,6 +36,7 @@ class Instruction {
     const vector<bool> val;
     const int index;
     const int logicIndex;
+    const DecodedInstruction &decoded;
     SpecificInstruction * const inst;
     const vector<Address> firstOrderAdr;
     const Address adr;
@@ -53,11 +56,10 @@ class Instruction {
                                                        int index);
 
   private:
-    vector<Address> getFirstOrderAdr(vector<bool> val);
+    vector<Address> getFirstOrderAdr();
     Address getAddress(Address firstOrderAdr, const vector<bool> &reg,
                        const Ram *ram);
     SpecificInstruction * getInstruction();
-    SpecificInstruction * getLogicInstruction();
 };
 
 #endif
\ No newline at end of file
@@ -1,45 +1,84 @@
 #include "interactive_mode.hpp"
 
+#include <stdio.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "comp.hpp"
 #include "computer.hpp"
 #include "cursor.hpp"
+#include "allocation_stats.hpp"
 #include "drawing3D.hpp"
 #include "drawing3Db.hpp"
 #include "drawing2D.hpp"
+#include "edit_history.hpp"
+#include "execution_log.hpp"
+#include "fast_cpu.hpp"
+#include "event_loop.hpp"
 #include "load.hpp"
 #include "output.hpp"
 #include "printer.hpp"
 #include "ram.hpp"
 #include "random_input.hpp"
 #include "renderer.hpp"
+#include "util.hpp"
 #include "view.hpp"
 
 using namespace std;
+using namespace std::chrono;
 
 extern "C" {
-  extern volatile sig_atomic_t pleaseExit;
   void setEnvironment();
 }
 
 // MAIN
 void startInteractiveMode(string filename);
+void initMachine(callback_function drawFrame, callback_function nextCycle);
+void initKeys();
 void selectView();
 void prepareOutput();
 void updateBuffer();
+size_t getStateHash();
+size_t hashState(const Printer &printerIn, const Ram &ramIn,
+                 const Cpu &cpuIn);
 // EXECUTION MODE
 void run();
 void exec();
-void sleepAndCheckForKey();
+void processKeyWhileRunning(int keyCode);
 void shouldQuit(int keyCode);
+// WORKER
+void startWorker();
+void joinWorker();
+void stopWorker();
+void sendControl(void (*change)(void));
+void execute();
+void sleepAndCheckForKey();
+void processControl();
+void publishFrame();
+void publishSnapshot();
+void waitUntilFrameDrawn();
+void acknowledgeFrame();
+void updateFrameOnScreen();
+void stepThroughLog(int delta);
+// CLOCK
+void startClock();
+bool tickClock();
+int getClockSpeed();
+void changeClockSpeed(int delta);
+nanoseconds getFramePeriod(int hz);
 // EDIT MODE
 void userInput();
+bool processKey(char c);
 bool switchKey(char c);
 void isertCharIntoRam(char c);
 bool processInputWithShift(char c);
@@ -55,6 +94,16 @@ string getGenericFileName(int index);
 void saveRamToFile(string filename);
 // KEY READER
 char readStdin();
+void processSignal(Event event);
+long getKeyStamp();
+void printReplayStats();
+// RENDER BENCHMARK
+void benchmarkView(const char *name, View *view);
+void stopBenchmarkIfDone();
+void checkRewind();
+FastCpu replayUntil(long cycle);
+void printRenderStatsHeader();
+void printRenderStats(const char *name);
 
 //////////////////////
 //////// VARS ////////
@@ -65,9 +114,11 @@ View view3db = View(drawing3Db, LIGHTBULB_ON_3D_B, LIGHTBULB_OFF_3D_B);
 View view2d = View(drawing2D, LIGHTBULB_ON_2D, LIGHTBULB_OFF_2D);
 View *selectedView = &view3d;
 RandomInput input;
-Computer computer = Computer(redrawScreen, sleepAndCheckForKey);
-Printer printer = Printer(computer, redrawScreen, sleepAndCheckForKey);
-Cursor cursor = Cursor(computer.ram);
+// Created when interactive mode starts (see 'initMachine()'), so other
+// modes don't pay for their construction.
+Computer *computer = NULL;
+Printer *printer = NULL;
+Cursor *cursor = NULL;
 
 // Whether esc was pressed during execution.
 bool executionCanceled = false;
@@ -77,37 +128,142 @@ bool fileSaved = true;
 // Number of executions.
 int executionCounter = 0;
 // Saved state of a ram. Loaded after execution ends.
-map<AddrSpace, vector<vector<bool>>> savedRamState;
+RamImage savedRamState;
+// Edits of the ram, that can be undone with 'u' and redone with ctrl-r.
+EditHistory history;
 // Whether next key should be read as a char whose value shall thence be
 // inserted into ram.
 bool insertChar = false;
 bool insertNumber = false;
 vector<int> digits;
 bool shiftPressed = false;
+// Whether lightbulbs are colored by how many times they were executed or
+// accessed (toggled with 'm').
+bool heatShown = false;
 // Copy/paste.
 vector<bool> clipboard = EMPTY_WORD;
+// Clock. Cpu executes cycles in batches (frames), and sleeps until the
+// deadline of the next frame after each batch. Speed is set by the main
+// thread, the rest is used only by the worker.
+atomic<size_t> clockSpeedIndex(DEFAULT_CLOCK_SPEED_INDEX);
+steady_clock::time_point nextFrame;
+double cyclesLeftInFrame = 0;
+bool frameDue = false;
+// Worker thread executes the program, while the main thread draws and
+// processes the keys. Main thread sends its requests by setting the flags
+// under the control lock. Pending flag gets checked by the worker every
+// cycle without the lock.
+thread worker;
+bool workerRunning = false;
+atomic<bool> workerFinished(false);
+mutex controlMutex;
+condition_variable controlChanged;
+atomic<bool> controlPending(false);
+bool pauseRequested = false;
+bool cancelRequested = false;
+// Set by the worker while it waits in pause.
+atomic<bool> workerPaused(false);
+// Snapshots of the machine, that the worker publishes once per frame.
+// Main thread draws the front one while the execution is running.
+struct Snapshot {
+  Computer computer;
+  Printer printer = Printer(computer, NULL, NULL);
+  size_t frame = 0;
+};
+Snapshot *snapshots = NULL;
+int frontSnapshot = 0;
+mutex snapshotMutex;
+// While replaying the keys, worker runs in lockstep with the main thread.
+// At the end of every frame it waits until main thread draws it and
+// processes the keys that are due, so keys and frames always happen at the
+// same cycles. Published is written by the worker, drawn by the main thread
+// under the control lock.
+size_t framesPublished = 0;
+size_t framesDrawn = 0;
+// Published frame that the main thread drew last, and its cycle.
+size_t frameOnScreen = 0;
+int cycleOnScreen = 0;
+// Cycles of the current execution. While paused, 'h' and 'l' step back
+// and forth through them, and the past state gets drawn instead of the
+// front snapshot. Used only by the main thread, and only while the worker
+// waits in pause.
+ExecutionLog executionLog;
+int cyclesBack = 0;
+Snapshot *pastSnapshot = NULL;
+// Recording and replaying of the keys (see 'event_loop.cpp').
+string recordKeysFilename;
+string replayKeysFilename;
+steady_clock::time_point replayStart;
+// Rendered frame. Kept between the frames so its lines get reused.
+vector<vector<Cell>> frame;
 
 //////////////////////
 //////// MAIN ////////
 //////////////////////
 
 void InteractiveMode::startInteractiveMode(string filename) {
-  computer.ram.input = &input;
+  initMachine(publishFrame, sleepAndCheckForKey);
+  computer->ram.input = &input;
+  computer->cpu.setLog(&executionLog);
   executionCanceled = false;
   if (filename != "") {
-    Load::fillRamWithFile(filename.c_str(), computer.ram);
+    Load::fillRamWithFile(filename.c_str(), computer->ram);
     loadedFilename = filename;
   }
   selectView();
-  setEnvironment();
+  initEventLoop();
+  initKeys();
+  if (!replayingKeys()) {
+    setEnvironment();
+  }
   prepareOutput();
   clearScreen();
   redrawScreen();
   userInput();
 }
 
+void InteractiveMode::recordKeys(string filename) {
+  recordKeysFilename = filename;
+}
+
+void InteractiveMode::replayKeys(string filename) {
+  replayKeysFilename = filename;
+}
+
+/*
+ * Computer and printer call 'drawFrame' after every cycle and 'nextCycle'
+ * before the next one.
+ */
+void initMachine(callback_function drawFrame, callback_function nextCycle) {
+  computer = new Computer(drawFrame, nextCycle);
+  printer = new Printer(*computer, drawFrame, nextCycle);
+  cursor = new Cursor(computer->ram);
+  snapshots = new Snapshot[2];
+  pastSnapshot = new Snapshot();
+}
+
+/*
+ * Random input gets seeded, so that the replay executes the same program
+ * the same way as it was executed while recording.
+ */
+void initKeys() {
+  if (!recordKeysFilename.empty()) {
+    startRecordingKeys(recordKeysFilename.c_str(), getKeyStamp);
+    srand(BENCHMARK_SEED);
+  }
+  if (!replayKeysFilename.empty()) {
+    startReplayingKeys(replayKeysFilename.c_str(), getKeyStamp);
+    srand(BENCHMARK_SEED);
+    replayStart = steady_clock::now();
+    atexit(printReplayStats);
+  }
+}
+
 void selectView() {
   const char* term = std::getenv("TERM");
+  if (term == NULL) {
+    return;
+  }
   if (strcmp(term, "linux") == 0) {
     selectedView = &view2d;
   } else if (strcmp(term, "rxvt") == 0) {
@@ -121,98 +277,190 @@ void selectView() {
  * screen redraw.
  */
 void prepareOutput() {
-  initOutput(&updateBuffer, selectedView->width, selectedView->height);
+  if (replayingKeys()) {
+    initHeadlessOutput(&updateBuffer, &getStateHash, selectedView->width,
+                       selectedView->height, selectedView->width,
+                       selectedView->height);
+    return;
+  }
+  initOutput(&updateBuffer, &getStateHash, selectedView->width,
+             selectedView->height);
 }
 
+/*
+ * While the program is running, it draws the last published snapshot.
+ */
 void updateBuffer() {
-  vector<vector<string>> tmp = Renderer::renderState(printer, computer.ram,
-                                                     computer.cpu, cursor,
-                                                     *selectedView);
+  if (cyclesBack > 0) {
+    Renderer::renderState(pastSnapshot->printer, pastSnapshot->computer.ram,
+                          pastSnapshot->computer.cpu, *cursor, *selectedView,
+                          frame, heatShown);
+  } else if (workerRunning) {
+    lock_guard<mutex> lock(snapshotMutex);
+    Snapshot &front = snapshots[frontSnapshot];
+    Renderer::renderState(front.printer, front.computer.ram,
+                          front.computer.cpu, *cursor, *selectedView, frame,
+                          heatShown);
+  } else {
+    Renderer::renderState(*printer, computer->ram, computer->cpu, *cursor,
+                          *selectedView, frame, heatShown);
+  }
   int i = 0;
-  for (vector<string> line : tmp) {
+  for (const vector<Cell> &line : frame) {
     replaceBufferLine(line, i++);
   }
 }
 
+/*
+ * Output skips rendering of the frame if the hash didn't change since the
+ * last one, so idle or paused machine doesn't use the cpu.
+ */
+size_t getStateHash() {
+  if (cyclesBack > 0) {
+    return hashState(pastSnapshot->printer, pastSnapshot->computer.ram,
+                     pastSnapshot->computer.cpu);
+  }
+  if (workerRunning) {
+    lock_guard<mutex> lock(snapshotMutex);
+    Snapshot &front = snapshots[frontSnapshot];
+    return hashState(front.printer, front.computer.ram, front.computer.cpu);
+  }
+  return hashState(*printer, computer->ram, computer->cpu);
+}
+
+/*
+ * Hashes everything that the renderer reads.
+ */
+size_t hashState(const Printer &printerIn, const Ram &ramIn,
+                 const Cpu &cpuIn) {
+  size_t hash = 0;
+  auto add = [&hash](size_t value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  for (AddrSpace space : { CODE, DATA }) {
+    for (const vector<bool> &word : ramIn.state.at(space)) {
+      add(Util::getInt(word));
+    }
+  }
+  add(Util::getInt(cpuIn.getPc()));
+  add(Util::getInt(cpuIn.getRegister()));
+  add(cpuIn.getCycle());
+  add(printerIn.getRevision());
+  add(cursor->getAddressSpace());
+  add(cursor->getAbsoluteBitIndex());
+  add((size_t) selectedView);
+  add(heatShown);
+  if (heatShown) {
+    for (AddrSpace space : { CODE, DATA }) {
+      for (size_t count : cpuIn.getHeat(space)) {
+        add(count);
+      }
+    }
+  }
+  return hash;
+}
+
 //////////////////////
 /// EXECUTION MODE ///
 //////////////////////
 
 /*
- * Saves the state of the ram and starts the execution of a program.
- * When execution stops, due to it reaching last address or user pressing
- * 'esc', it loads back the saved state of the ram, and resets the cpu.
+ * Saves the state of the ram and starts the execution of a program in the
+ * worker thread. Meanwhile the main thread draws the snapshots that worker
+ * publishes and processes the keys. When execution stops, due to it reaching
+ * last address or user pressing 'esc', it loads back the saved state of the
+ * ram, and resets the cpu.
  */
 void run() {
-  savedRamState = computer.ram.state;
-  computer.cpu.switchOn();
+  savedRamState = computer->ram.getImage();
+  computer->cpu.switchOn();
+  executionLog.start(computer->cpu.getCycle());
+  startWorker();
+  redrawScreen();
+  updateFrameOnScreen();
+  // Whether the last frame was skipped, because terminal was too slow.
+  bool redrawPending = false;
+  while (!workerFinished) {
+    char keyCode;
+    int timeout = redrawPending ? 1000 / FRAME_RATE : -1;
+    if (replayingKeys() && !keysPending() && !keysDue()) {
+      acknowledgeFrame();
+    }
+    Event event = waitForEvent(timeout, keyCode);
+    if (event == WAKE_EVENT || event == NO_EVENT) {
+      redrawPending = !redrawScreenIfReady();
+      if (!redrawPending) {
+        updateFrameOnScreen();
+      }
+    } else if (event == KEY_EVENT) {
+      processKeyWhileRunning(keyCode);
+    } else {
+      processSignal(event);
+    }
+  }
+  joinWorker();
   redrawScreen();
-  sleepAndCheckForKey();
-  printer.run();
   // If 'esc' was pressed then it doesn't wait for keypress at the end.
   if (executionCanceled) {
     executionCanceled = false;
   } else {
     readStdin();
   }
-  computer.ram.state = savedRamState;
-  computer.cpu.reset();
+  computer->ram.setImage(savedRamState);
+  computer->cpu.reset();
   redrawScreen();
   executionCounter++;
 }
 
 /*
- * Runs every cycle.
+ * Pauses execution if a key was hit, and continues it on the next key hit.
+ * Keys that stop the execution wait for the worker to finish first, so they
+ * can use the computer and the printer.
  */
-void sleepAndCheckForKey() {
-  usleep(FQ*1000);
-  // Exits if ctrl-c was pressed.
-  if (pleaseExit) {
-    exit(0);
+void processKeyWhileRunning(int keyCode) {
+  // Quits if q or Q was pressed.
+  if (keyCode == 81 || keyCode == 113) {
+    stopWorker();
+    shouldQuit(keyCode);
   }
-  if (screenResized) {
+  // Cancels execution if escape (or tab while paused) was pressed.
+  if (keyCode == 27 || (pauseRequested && keyCode == 9)) {
+    stopWorker();
+    return;
+  }
+  // If s was pressed - save.
+  if (keyCode == 115) {
+    stopWorker();
+    save();
+    return;
+  }
+  // If S was pressed - save as.
+  if (keyCode == 83) {
+    stopWorker();
+    saveAs();
+    return;
+  }
+  // If < or > was pressed - change speed without pausing.
+  if (!pauseRequested && (keyCode == 60 || keyCode == 62)) {
+    changeClockSpeed(keyCode == 62 ? 1 : -1);
+    return;
+  }
+  // If m was pressed - toggle heatmap without pausing or continuing.
+  if (keyCode == 109) {
+    heatShown = !heatShown;
     redrawScreen();
+    return;
   }
-  // Pauses execution if a key was hit, and waits for another key hit.
-  if (int keyCode = Util::getKey()) {
-    // Quits if q or Q was pressed.
-    shouldQuit(keyCode);
-    // Cancels execution if escape was pressed.
-    if (keyCode == 27) {
-      executionCanceled = true;
-      return;
-    }
-    // If s was pressed - save.
-    if (keyCode == 115) {
-      save();
-      executionCanceled = true;
-      return;
-    }
-    // If S was pressed - save as.
-    if (keyCode == 83) {
-      saveAs();
-      executionCanceled = true;
-      return;
-    }
-    // "Press key to continue."
-    keyCode = readStdin();
-    // Quits if q or Q was pressed.
-    shouldQuit(keyCode);
-    // Cancels execution if escape or tab was pressed.
-    if (keyCode == 27 || keyCode == 9) {
-      executionCanceled = true;
-    }
-    // If s was pressed - save.
-    if (keyCode == 115) {
-      save();
-      executionCanceled = true;
-    }
-    // If S was pressed - save as.
-    if (keyCode == 83) {
-      saveAs();
-      executionCanceled = true;
-    }
+  // If h or l was pressed while paused - step back or forth through the
+  // executed cycles.
+  if (pauseRequested && (keyCode == 104 || keyCode == 108)) {
+    stepThroughLog(keyCode == 104 ? 1 : -1);
+    redrawScreen();
+    return;
   }
+  // "Press key to continue."
+  cyclesBack = 0;
+  sendControl([] { pauseRequested = !pauseRequested; });
 }
 
 void shouldQuit(int keyCode) {
@@ -229,35 +477,339 @@ void shouldQuit(int keyCode) {
   }
 }
 
+//////////////
+/// WORKER ///
+//////////////
+
+void startWorker() {
+  workerFinished = false;
+  pauseRequested = false;
+  cancelRequested = false;
+  controlPending = false;
+  publishSnapshot();
+  workerRunning = true;
+  worker = thread(execute);
+}
+
+void joinWorker() {
+  if (worker.joinable()) {
+    worker.join();
+  }
+  workerRunning = false;
+  cyclesBack = 0;
+}
+
+/*
+ * Asks the worker to cancel the execution, and waits until it does.
+ */
+void stopWorker() {
+  if (!worker.joinable()) {
+    return;
+  }
+  sendControl([] { cancelRequested = true; });
+  joinWorker();
+}
+
+/*
+ * Changes the requests under the lock and wakes the worker, if it's asleep.
+ */
+void sendControl(void (*change)(void)) {
+  {
+    lock_guard<mutex> lock(controlMutex);
+    change();
+    controlPending = true;
+  }
+  controlChanged.notify_all();
+}
+
+/*
+ * Runs in the worker thread.
+ */
+void execute() {
+  startClock();
+  sleepAndCheckForKey();
+  printer->run();
+  workerFinished = true;
+  wakeEventLoop();
+}
+
+/*
+ * Runs every cycle in the worker thread. At the end of a frame it sleeps
+ * until the next one, but wakes up as soon as main thread sends a request.
+ */
+void sleepAndCheckForKey() {
+  if (controlPending) {
+    processControl();
+    return;
+  }
+  if (!tickClock()) {
+    return;
+  }
+  if (replayingKeys()) {
+    waitUntilFrameDrawn();
+    return;
+  }
+  frameDue = true;
+  if (CLOCK_SPEEDS[clockSpeedIndex] == 0) {
+    return;
+  }
+  {
+    unique_lock<mutex> lock(controlMutex);
+    controlChanged.wait_until(lock, nextFrame,
+                              [] { return (bool) controlPending; });
+  }
+  if (controlPending) {
+    processControl();
+  }
+}
+
+/*
+ * Worker's side of the requests. While paused, it publishes the current
+ * state and waits for the main thread.
+ */
+void processControl() {
+  unique_lock<mutex> lock(controlMutex);
+  controlPending = false;
+  if (pauseRequested && !cancelRequested) {
+    workerPaused = true;
+    publishSnapshot();
+    controlChanged.wait(lock, [] {
+      return !pauseRequested || cancelRequested;
+    });
+    workerPaused = false;
+    controlPending = false;
+  }
+  if (cancelRequested) {
+    executionCanceled = true;
+  }
+  startClock();
+}
+
+/*
+ * Runs every cycle in the worker thread, but publishes the state only once
+ * per frame.
+ */
+void publishFrame() {
+  if (frameDue) {
+    frameDue = false;
+    publishSnapshot();
+  }
+}
+
+/*
+ * Copies the state into the back snapshot and makes it the front one. Main
+ * thread only reads the front snapshot, and only under the lock, so the
+ * back one can be written without it.
+ */
+void publishSnapshot() {
+  Snapshot &back = snapshots[1 - frontSnapshot];
+  back.frame = ++framesPublished;
+  back.computer.ram.state = computer->ram.state;
+  back.computer.cpu.setPc(computer->cpu.getPc());
+  back.computer.cpu.setRegister(computer->cpu.getRegister());
+  back.computer.cpu.setCycle(computer->cpu.getCycle());
+  back.computer.cpu.copyHeat(computer->cpu);
+  back.printer.copyPaper(*printer);
+  {
+    lock_guard<mutex> lock(snapshotMutex);
+    frontSnapshot = 1 - frontSnapshot;
+  }
+  wakeEventLoop();
+}
+
+/*
+ * Publishes the frame and waits until the main thread acknowledges it, or
+ * cancels the execution. Previous frame (published at the start or at
+ * the pause) must get drawn first, so every frame gets drawn on its own.
+ */
+void waitUntilFrameDrawn() {
+  auto frameDrawn = [] {
+    return framesDrawn >= framesPublished || cancelRequested;
+  };
+  {
+    unique_lock<mutex> lock(controlMutex);
+    controlChanged.wait(lock, frameDrawn);
+  }
+  publishSnapshot();
+  {
+    unique_lock<mutex> lock(controlMutex);
+    controlChanged.wait(lock, frameDrawn);
+  }
+  if (controlPending) {
+    processControl();
+  }
+}
+
+/*
+ * Main thread's side of the lockstep. Lets the worker continue past the
+ * frame that is on the screen.
+ */
+void acknowledgeFrame() {
+  {
+    lock_guard<mutex> lock(controlMutex);
+    framesDrawn = frameOnScreen;
+  }
+  controlChanged.notify_all();
+}
+
+void updateFrameOnScreen() {
+  lock_guard<mutex> lock(snapshotMutex);
+  frameOnScreen = snapshots[frontSnapshot].frame;
+  cycleOnScreen = snapshots[frontSnapshot].computer.cpu.getCycle();
+}
+
+/*
+ * Rewinds the front snapshot (which is the state that worker paused at) by
+ * the new number of cycles. Does nothing if worker didn't pause yet, or if
+ * the cycle is not in the log anymore.
+ */
+void stepThroughLog(int delta) {
+  if (!workerPaused) {
+    return;
+  }
+  int cycles = max(cyclesBack + delta, 0);
+  lock_guard<mutex> lock(snapshotMutex);
+  Snapshot &front = snapshots[frontSnapshot];
+  int presentCycle = front.computer.cpu.getCycle();
+  int cycle = presentCycle - cycles;
+  if (cycle < 1 || !executionLog.canRewind(presentCycle, cycle)) {
+    return;
+  }
+  cyclesBack = cycles;
+  FastCpu past;
+  past.load(front.computer.ram, front.computer.cpu);
+  size_t outputs = executionLog.rewind(past, cycle);
+  pastSnapshot->computer.ram.state = front.computer.ram.state;
+  past.store(pastSnapshot->computer.ram, pastSnapshot->computer.cpu);
+  pastSnapshot->computer.cpu.setCycle(cycle);
+  pastSnapshot->computer.cpu.copyHeat(front.computer.cpu);
+  pastSnapshot->printer.copyPaper(front.printer, outputs);
+}
+
+/////////////
+/// CLOCK ///
+/////////////
+
+void startClock() {
+  nextFrame = steady_clock::now();
+  cyclesLeftInFrame = 0;
+}
+
+/*
+ * Returns whether the cycle was the last one of the frame. In that case it
+ * also advances the deadline of the next frame. Deadlines are absolute, so
+ * time spent executing and drawing doesn't slow the clock down. If cpu falls
+ * behind for more than a frame, the clock gets reset instead of running the
+ * missed cycles at once.
+ */
+bool tickClock() {
+  int hz = getClockSpeed();
+  nanoseconds framePeriod = getFramePeriod(hz);
+  if (hz == 0) {
+    steady_clock::time_point now = steady_clock::now();
+    if (now < nextFrame) {
+      return false;
+    }
+    nextFrame = now + framePeriod;
+    return true;
+  }
+  if (--cyclesLeftInFrame > 0) {
+    return false;
+  }
+  cyclesLeftInFrame += (double) hz * framePeriod.count() / 1e9;
+  nextFrame += framePeriod;
+  if (replayingKeys()) {
+    return true;
+  }
+  steady_clock::time_point now = steady_clock::now();
+  if (nextFrame + framePeriod < now) {
+    nextFrame = now;
+  }
+  return true;
+}
+
+/*
+ * Replay has no real time, so turbo runs at the fastest of the clock
+ * speeds, and frames end after the same cycles every time.
+ */
+int getClockSpeed() {
+  int hz = CLOCK_SPEEDS[clockSpeedIndex];
+  if (hz == 0 && replayingKeys()) {
+    return CLOCK_SPEEDS[CLOCK_SPEEDS.size() - 2];
+  }
+  return hz;
+}
+
+/*
+ * Worker picks up the new speed on its next cycle.
+ */
+void changeClockSpeed(int delta) {
+  int index = (int) clockSpeedIndex + delta;
+  index = max(0, min(index, (int) CLOCK_SPEEDS.size() - 1));
+  clockSpeedIndex = index;
+  sendControl([] { });
+}
+
+/*
+ * Frame lasts for one cycle, or for one redraw, whichever is longer.
+ */
+nanoseconds getFramePeriod(int hz) {
+  nanoseconds redrawPeriod = nanoseconds(1000000000L / FRAME_RATE);
+  if (hz == 0) {
+    return redrawPeriod;
+  }
+  return max(nanoseconds(1000000000L / hz), redrawPeriod);
+}
+
 ////////////////////
 /// EDITING MODE ///
 ////////////////////
 
+/*
+ * Screen gets redrawn only after the last key of a burst (held or pasted
+ * keys), if any of them asked for it. Changes of the ram get recorded as
+ * one edit in the history per burst, and per entered number.
+ */
 void userInput() {
+  bool redrawNeeded = false;
+  history.start(computer->ram);
   while(1) {
     char c = readStdin();
-    if (insertChar) {
-      isertCharIntoRam(c);
-      fileSaved = false;
-    } else if (shiftPressed) {
-      bool shouldContinue = !processInputWithShift(c);
-      if (shouldContinue) {
-        continue;
-      }
-    } else {
-      if (insertNumber) {
-        if (insertNumberIntoRam(c)) {
-          fileSaved = false;
-          continue;
-        }
-      }
-      bool shouldContinue = switchKey(c);
-      if (shouldContinue) {
-        continue;
+    redrawNeeded = processKey(c) || redrawNeeded;
+    if (!insertNumber && !keysPending()) {
+      history.record(computer->ram);
+    }
+    if (redrawNeeded && !keysPending()) {
+      redrawScreen();
+      redrawNeeded = false;
+    }
+  }
+}
+
+/*
+ * Returns whether screen should be redrawn.
+ */
+bool processKey(char c) {
+  if (insertChar) {
+    isertCharIntoRam(c);
+    fileSaved = false;
+  } else if (shiftPressed) {
+    return processInputWithShift(c);
+  } else {
+    if (insertNumber) {
+      if (insertNumberIntoRam(c)) {
+        fileSaved = false;
+        return true;
       }
+      // Entered number is its own edit, apart from the key that ended it.
+      history.record(computer->ram);
+    }
+    bool shouldContinue = switchKey(c);
+    if (shouldContinue) {
+      return false;
     }
-    redrawScreen();
   }
+  return true;
 }
 
 bool switchKey(char c) {
@@ -283,6 +835,24 @@ bool switchKey(char c) {
     case 46:    // .
       switchDrawing(false);
       break;
+    case 109:   // m
+      heatShown = !heatShown;
+      break;
+    // UNDO
+    // Edit that is still in progress gets recorded first, so it is the one
+    // that gets undone.
+    case 117:   // u
+      history.record(computer->ram);
+      if (history.undo(computer->ram)) {
+        fileSaved = false;
+      }
+      break;
+    case 18:    // ctrl-r
+      history.record(computer->ram);
+      if (history.redo(computer->ram)) {
+        fileSaved = false;
+      }
+      break;
     // SAVE
     case 115:   // s
       save();
@@ -300,66 +870,66 @@ bool switchKey(char c) {
     // BASIC MOVEMENT
     case 107:   // k
     case 65:    // A, part of escape seqence of up arrow
-      cursor.decreaseY();
+      cursor->decreaseY();
       break;
     case 106:   // j
     case 66:    // B, part of escape seqence of down arrow
-      cursor.increaseY();
+      cursor->increaseY();
       break;
     case 108:   // l
     case 67:    // C, part of escape seqence of rigth arrow
-      cursor.increaseX();
+      cursor->increaseX();
       break;
     case 104:   // h
     case 68:    // D, part of escape seqence of left arrow
-      cursor.decreaseX();
+      cursor->decreaseX();
       break;
     case 116:   // t
     case 9:     // tab
-      cursor.switchAddressSpace();
+      cursor->switchAddressSpace();
       break;
     case 72:    // H (home)
     case 94:    // ^
-      cursor.setBitIndex(0);
+      cursor->setBitIndex(0);
       break;
     case 70:    // F (end)
     case 36:    // $
-      cursor.setBitIndex(WORD_SIZE-1);
+      cursor->setBitIndex(WORD_SIZE-1);
       break;
     // VIM MOVEMENT
     case 103:   // g
-      cursor.setByteIndex(0);
+      cursor->setByteIndex(0);
       break;
     case 71:    // G
-      cursor.setByteIndex(RAM_SIZE-1);
+      cursor->setByteIndex(RAM_SIZE-1);
       break;
     case 101:   // e
-      cursor.goToEndOfWord();
+      cursor->goToEndOfWord();
       break;
     case 98:    // b
-      cursor.goToBeginningOfWord();
+      cursor->goToBeginningOfWord();
       break;
     case 119:   // w
-      cursor.goToBeginningOfNextWord();
+      cursor->goToBeginningOfNextWord();
       break;
     case 97:    // a
-      cursor.setBitIndex(4);
+      cursor->setBitIndex(4);
       break;
     case 122:   // z
     case 90:    // shift + tab
     case 84:    // T
-      cursor.goToInstructionsAddress();
+      cursor->goToInstructionsAddress();
       break;
     // BASIC MANIPULATION
     case 32:    // space
-      cursor.switchBit();
+      cursor->switchBit();
       fileSaved = false;
       break;
     case 51:    // 3, part of escape seqence of delete key
     case 127:   // backspace
     case 120: { // x
-      vector<bool> temp = cursor.getWord();
-      bool success = cursor.deleteByteAndMoveRestUp();
+      vector<bool> temp = cursor->getWord();
+      bool success = cursor->deleteByteAndMoveRestUp();
       if (success) {
         fileSaved = false;
       } else {
@@ -369,66 +939,78 @@ bool switchKey(char c) {
     }
     case 75:    // K
     case 53:    // 5, part of escape seqence of page up
-      cursor.moveByteUp();
+      cursor->moveByteUp();
       fileSaved = false;
       break;
     case 74:    // J
     case 54:    // 6, part of escape seqence of page down
-      cursor.moveByteDown();
+      cursor->moveByteDown();
       fileSaved = false;
       break;
     // VIM MANIPULATION
     case 43:    // +
-      cursor.increaseByteValue();
+      cursor->increaseByteValue();
       fileSaved = false;
       break;
     case 45:    // -
-      cursor.decreaseByteValue();
+      cursor->decreaseByteValue();
       fileSaved = false;
       break;
     case 102:   // f
-      cursor.setBit(true);
-      cursor.increaseX();
+      cursor->setBit(true);
+      cursor->increaseX();
       fileSaved = false;
       break;
     case 100:   // d
-      cursor.setBit(false);
-      cursor.increaseX();
+      cursor->setBit(false);
+      cursor->increaseX();
       fileSaved = false;
       break;
     case 111: { // o
-      cursor.increaseY();
-      bool success = cursor.insertByteAndMoveRestDown();
+      cursor->increaseY();
+      bool success = cursor->insertByteAndMoveRestDown();
       if (success) {
-        cursor.setBitIndex(0);
+        cursor->setBitIndex(0);
         fileSaved = false;
       } else {
-        cursor.decreaseY();
+        cursor->decreaseY();
       }
       break;
     }
     case 93: {  // ]
-      cursor.insertByteAndMoveRestDown();
+      cursor->insertByteAndMoveRestDown();
       fileSaved = false;
       break;
     }
     case 99:    // c
     case 121:   // y
-      clipboard = cursor.getWord();
+      clipboard = cursor->getWord();
       break;
     case 118:   // v
     case 112:   // p
-      cursor.setWord(clipboard);
+      cursor->setWord(clipboard);
       fileSaved = false;
       break;
     case 80: {  // P
-      bool success = cursor.insertByteAndMoveRestDown();
+      bool success = cursor->insertByteAndMoveRestDown();
       if (success) {
-        cursor.setWord(clipboard);
+        cursor->setWord(clipboard);
       fileSaved = false;
       }
       break;
     }
+    case 60:    // <
+      changeClockSpeed(-1);
+      break;
+    case 62:    // >
+      changeClockSpeed(1);
+      break;
+    case 123:   // {
+      printer->scroll(1);
+      break;
+    case 125:   // }
+      printer->scroll(-1);
+      break;
     default:
       return true;
   }
@@ -440,8 +1022,8 @@ void isertCharIntoRam(char c) {
   if (c == 27) {  // Esc
     return;
   }
-  cursor.setWord(Util::getBoolByte(c));
-  cursor.increaseY();
+  cursor->setWord(Util::getBoolByte(c));
+  cursor->increaseY();
 }
 
 /*
@@ -450,23 +1032,23 @@ void isertCharIntoRam(char c) {
 bool processInputWithShift(char c) {
   shiftPressed = 0;
   if (c == 65) {           // A, part of up arrow
-    cursor.moveByteUp();
+    cursor->moveByteUp();
     fileSaved = false;
     return true;
   } else if (c == 66) {    // B, part of down arrow
-    cursor.moveByteDown();
+    cursor->moveByteDown();
     fileSaved = false;
     return true;
   } else if (c == 67) {    // C, part of right arrow
-    cursor.increaseByteValue();
+    cursor->increaseByteValue();
     fileSaved = false;
     return true;
   } else if (c == 68) {    // D, part of left arrow
-    cursor.decreaseByteValue();
+    cursor->decreaseByteValue();
     fileSaved = false;
     return true;
   } else if (c == 126) {   // ~, part of insert key (also is 2)
-    cursor.insertByteAndMoveRestDown();
+    cursor->insertByteAndMoveRestDown();
     fileSaved = false;
     return true;
   } else {
@@ -487,19 +1069,18 @@ bool insertNumberIntoRam(char c) {
   for (int digit : digits) {
     numbersValue += digit * pow(10, i++);
   }
-  cursor.setWord(Util::getBoolByte(numbersValue));
-  redrawScreen();
+  cursor->setWord(Util::getBoolByte(numbersValue));
   return true;
 }
 
 void engageInsertCharMode() {
-  if (cursor.getAddressSpace() == DATA) {
+  if (cursor->getAddressSpace() == DATA) {
     insertChar = true;
   }
 }
 
 void engageInsertNumberMode() {
-  if (cursor.getAddressSpace() == DATA) {
+  if (cursor->getAddressSpace() == DATA) {
     insertNumber = true;
   }
 }
@@ -534,7 +1115,7 @@ void switchDrawing(bool direction) {
 
 void save() {
   if (fileSaved) {
-    printer.printString("Saved "+loadedFilename);
+    printer->printString("Saved "+loadedFilename);
     return;
   }
   if (loadedFilename.empty()) {
@@ -542,7 +1123,7 @@ void save() {
   } else {
     saveRamToFile(loadedFilename);
     fileSaved = true;
-    printer.printString("Saved "+loadedFilename);
+    printer->printString("Saved "+loadedFilename);
     redrawScreen();
   }
 }
@@ -552,7 +1133,7 @@ void saveAs() {
   saveRamToFile(fileName);
   loadedFilename = fileName;
   fileSaved = true;
-  printer.printString("Saved as "+fileName);
+  printer->printString("Saved as "+fileName);
   redrawScreen();
 }
 
@@ -574,11 +1155,13 @@ string getGenericFileName(int index) {
 
 void saveRamToFile(string fileName) {
   ofstream fileStream(fileName);
-  bool computerRunning = computer.cpu.getCycle() != 0;
+  bool computerRunning = computer->cpu.getCycle() != 0;
   if (computerRunning) {
-    fileStream << Ram::stateToString(savedRamState);
+    Ram savedRam;
+    savedRam.setImage(savedRamState);
+    fileStream << savedRam.getString();
   } else {
-    fileStream << computer.ram.getString();
+    fileStream << computer->ram.getString();
   }
   fileStream.close();
 }
@@ -587,19 +1170,163 @@ void saveRamToFile(string fileName) {
 /// KEY READER ///
 //////////////////
 
+/*
+ * Blocks until a key is pressed. Meanwhile it processes the signals.
+ */
 char readStdin() {
   char c = 0;
-  errno = 0;
-  ssize_t num = read(0, &c, 1);
-  if (num == -1 && errno == EINTR) {
-    // Exits if ctrl-c was pressed.
-    if (pleaseExit) {
-      exit(0);
+  Event event = waitForEvent(-1, c);
+  while (event != KEY_EVENT) {
+    processSignal(event);
+    event = waitForEvent(-1, c);
+  }
+  return c;
+}
+
+void processSignal(Event event) {
+  // Exits if ctrl-c was pressed.
+  if (event == QUIT_EVENT) {
+    stopWorker();
+    exit(0);
+  }
+  if (event == RESIZE_EVENT) {
+    redrawScreen();
+  }
+}
+
+/*
+ * Keys get stamped with the cycle of the machine that is on the screen,
+ * or zero if machine is not running (or is paused), so that the replay can
+ * send them at the same point of the execution.
+ */
+long getKeyStamp() {
+  bool paused = pauseRequested && workerPaused;
+  if (!workerRunning || workerFinished || paused) {
+    return 0;
+  }
+  return cycleOnScreen;
+}
+
+void printReplayStats() {
+  duration<double, milli> elapsed = steady_clock::now() - replayStart;
+  printRenderStatsHeader();
+  printRenderStats("replay");
+  printf("Replayed in %.1f ms.\n", elapsed.count());
+}
+
+////////////////////////
+/// RENDER BENCHMARK ///
+////////////////////////
+
+/*
+ * Executes the program in each of the views, with output going to
+ * a virtual terminal of the drawing's size instead of stdout, and a frame
+ * rendered after every cycle. Prints what the output would send to the
+ * terminal to stdout.
+ */
+void InteractiveMode::runRenderBenchmark(string filename) {
+  initMachine(redrawScreen, stopBenchmarkIfDone);
+  computer->ram.input = &input;
+  computer->cpu.setLog(&executionLog);
+  Load::fillRamWithFile(filename.c_str(), computer->ram);
+  savedRamState = computer->ram.getImage();
+  printRenderStatsHeader();
+  benchmarkView("3d", &view3d);
+  benchmarkView("3d-b", &view3db);
+  benchmarkView("2d", &view2d);
+}
+
+/*
+ * Input is random, but seeded, so all views get the same execution.
+ */
+void benchmarkView(const char *name, View *view) {
+  selectedView = view;
+  computer->ram.setImage(savedRamState);
+  computer->cpu.reset();
+  printer->clear();
+  srand(BENCHMARK_SEED);
+  executionCanceled = false;
+  initHeadlessOutput(&updateBuffer, &getStateHash, view->width,
+                     view->height, view->width, view->height);
+  clearScreen();
+  resetRenderStats();
+  computer->cpu.switchOn();
+  executionLog.start(computer->cpu.getCycle());
+  redrawScreen();
+  printer->run();
+  printRenderStats(name);
+  checkRewind();
+}
+
+void stopBenchmarkIfDone() {
+  if (computer->cpu.getCycle() >= RENDER_BENCHMARK_CYCLES) {
+    executionCanceled = true;
+  }
+}
+
+/*
+ * Rewinds the state at the end of the benchmark by a few numbers of cycles,
+ * and compares it with the state that the program reaches when executed
+ * again up to that cycle. Aborts if they differ.
+ */
+void checkRewind() {
+  long presentCycle = computer->cpu.getCycle();
+  // Cycle that reached the last address doesn't get recorded.
+  if (!executionLog.canRewind(presentCycle, presentCycle - 1)) {
+    presentCycle--;
+  }
+  long firstCycle = executionLog.getFirstCycle(presentCycle);
+  for (long cyclesBack : { 1, 10, 100, RENDER_BENCHMARK_CYCLES }) {
+    long cycle = max(presentCycle - cyclesBack, firstCycle);
+    if (cycle >= presentCycle) {
+      return;
     }
-    if (screenResized) {
-      redrawScreen();
+    FastCpu past;
+    past.cycle = presentCycle;
+    executionLog.rewind(past, cycle);
+    FastCpu replayed = replayUntil(cycle);
+    bool same = memcmp(past.data, replayed.data, RAM_SIZE) == 0 &&
+                past.pc == replayed.pc && past.reg == replayed.reg;
+    if (!same) {
+      fprintf(stderr, "Rewinding from cycle %ld to cycle %ld gave a wrong "
+              "state. Aborting.\n", presentCycle, cycle);
+      exit(1);
     }
-    return readStdin();
   }
-  return c;
+}
+
+/*
+ * Executes the program from the start with the same input as the benchmark.
+ */
+FastCpu replayUntil(long cycle) {
+  computer->ram.setImage(savedRamState);
+  computer->cpu.reset();
+  computer->cpu.switchOn();
+  srand(BENCHMARK_SEED);
+  FastCpu replayed;
+  replayed.load(computer->ram, computer->cpu);
+  while (replayed.cycle < cycle &&
+         replayed.run(cycle - replayed.cycle) != FastCpu::END) { }
+  return replayed;
+}
+
+void printRenderStatsHeader() {
+  printf("%-6s%8s%12s%12s%12s%12s%13s\n", "view", "frames", "bytes/frame",
+         "escs/frame", "cells/frame", "us/frame", "allocs/frame");
+}
+
+/*
+ * Allocations are printed as '-' if they weren't counted.
+ */
+void printRenderStats(const char *name) {
+  RenderStats stats = getRenderStats();
+  double frames = max(stats.frames, (size_t) 1);
+  printf("%-6s%8zu%12.0f%12.1f%12.1f%12.1f", name, stats.frames,
+         stats.bytes / frames, stats.escapeSequences / frames,
+         stats.cellsChanged / frames, stats.renderTime.count() / frames / 1e3);
+  if (AllocationStats::enabled()) {
+    printf("%13.1f\n", stats.allocations / frames);
+  } else {
+    printf("%13s\n", "-");
+  }
 }
@@ -8,6 +8,9 @@ using namespace std;
 class InteractiveMode {
   public:
     static void startInteractiveMode(string filename);
+    static void runRenderBenchmark(string filename);
+    static void recordKeys(string filename);
+    static void replayKeys(string filename);
 };
 
 #endif
\ No newline at end of file
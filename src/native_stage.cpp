@@ -0,0 +1,134 @@
+#include "native_stage.hpp"
+
+#include <dlfcn.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "const.hpp"
+#include "provides_output.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+static bool writeFile(int fd, const string &text);
+static bool runCompiler(int sourceFd, const string &libraryName);
+static unsigned char readInput(void *context);
+
+/*
+ * Starts compilation in a detached thread. Thread keeps its own reference
+ * to the stage, so it can finish even if nobody waits for it.
+ */
+shared_ptr<NativeStage> NativeStage::compileInBackground(string source) {
+  shared_ptr<NativeStage> stage = make_shared<NativeStage>();
+  thread([stage, source]() { stage->compile(source); }).detach();
+  return stage;
+}
+
+bool NativeStage::isReady() const {
+  return status.load(memory_order_acquire) == READY;
+}
+
+bool NativeStage::hasFailed() const {
+  return status.load(memory_order_acquire) == FAILED;
+}
+
+/*
+ * Continues execution from the passed state, until the program writes to
+ * the output, and returns the written value, or END.
+ */
+int NativeStage::run(ProvidesOutput *input, unsigned char *data,
+                     unsigned char &reg, unsigned char &pc) {
+  return function(&readInput, input, data, reg, pc);
+}
+
+/*
+ * Writes the source to a temporary file, compiles it and loads the library.
+ * Source file gets deleted right away and compiler reads it from the open
+ * descriptor, while library gets deleted after it is loaded.
+ */
+void NativeStage::compile(string source) {
+  char sourceName[] = "/tmp/comp-stage-XXXXXX";
+  int fd = mkstemp(sourceName);
+  if (fd == -1) {
+    status.store(FAILED, memory_order_release);
+    return;
+  }
+  unlink(sourceName);
+  string libraryName = string(sourceName) + ".so";
+  bool compiled = writeFile(fd, source) && lseek(fd, 0, SEEK_SET) == 0 &&
+                  runCompiler(fd, libraryName);
+  close(fd);
+  if (!compiled) {
+    unlink(libraryName.c_str());
+    status.store(FAILED, memory_order_release);
+    return;
+  }
+  void *library = dlopen(libraryName.c_str(), RTLD_NOW | RTLD_LOCAL);
+  unlink(libraryName.c_str());
+  if (library != NULL) {
+    function = (StageFunction) dlsym(library, "stage");
+  }
+  if (function == NULL) {
+    status.store(FAILED, memory_order_release);
+    return;
+  }
+  status.store(READY, memory_order_release);
+}
+
+//////////
+// UTIL //
+//////////
+
+bool writeFile(int fd, const string &text) {
+  size_t written = 0;
+  while (written < text.size()) {
+    ssize_t res = write(fd, text.c_str() + written, text.size() - written);
+    if (res <= 0) {
+      return false;
+    }
+    written += res;
+  }
+  return true;
+}
+
+/*
+ * Runs the compiler with source on its stdin, and discards its messages.
+ * Doesn't use system(), because it would ignore SIGINT in the whole process
+ * while the compiler is running. On Linux compiler also gets killed if comp
+ * exits before compilation is finished.
+ */
+bool runCompiler(int sourceFd, const string &libraryName) {
+  string command = "exec " + NATIVE_GCC_COMMAND + " " + libraryName +
+                   " -x c++ - >/dev/null 2>&1";
+  pid_t pid = fork();
+  if (pid == -1) {
+    return false;
+  }
+  if (pid == 0) {
+#ifdef __linux__
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+    dup2(sourceFd, STDIN_FILENO);
+    execl("/bin/sh", "sh", "-c", command.c_str(), (char *) NULL);
+    _exit(127);
+  }
+  int status;
+  if (waitpid(pid, &status, 0) == -1) {
+    return false;
+  }
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+unsigned char readInput(void *context) {
+  return Util::getInt(((ProvidesOutput *) context)->getOutput());
+}
@@ -0,0 +1,40 @@
+#ifndef NATIVE_STAGE_H
+#define NATIVE_STAGE_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+using namespace std;
+
+class ProvidesOutput;
+
+/*
+ * Program of one computer, compiled to a shared library with g++ and loaded
+ * with dlopen. Compilation runs in a background thread, so the computer can
+ * keep running on the interpreter in the meantime.
+ */
+class NativeStage {
+  public:
+    // Signature of the 'stage' function in the generated library (see
+    // Parser::getNativeStage()).
+    typedef int (*StageFunction)(unsigned char (*input)(void *),
+                                 void *context, unsigned char *data,
+                                 unsigned char &reg, unsigned char &pc);
+    // Returned by run() when execution reaches the last address.
+    static const int END = -1;
+
+    static shared_ptr<NativeStage> compileInBackground(string source);
+    bool isReady() const;
+    bool hasFailed() const;
+    int run(ProvidesOutput *input, unsigned char *data, unsigned char &reg,
+            unsigned char &pc);
+
+  private:
+    enum Status { COMPILING, READY, FAILED };
+    atomic<int> status { COMPILING };
+    StageFunction function = NULL;
+    void compile(string source);
+};
+
+#endif
@@ -4,10 +4,10 @@
 #include <string>
 #include <vector>
 
-#include "computer.hpp"
 #include "load.hpp"
 #include "pipe_input.hpp"
 #include "standard_output.hpp"
+#include "tiered_computer.hpp"
 
 using namespace std;
 
@@ -17,28 +17,34 @@ class NoninteractiveMode {
   public:
     NoninteractiveMode(vector<string> filenamesIn, bool outputNumbers, 
                        bool outputChars, bool inputChars, bool rawInput) 
-        : computerChain(vector<Computer>(filenamesIn.size())),
+        : computerChain(vector<TieredComputer>(filenamesIn.size())),
           output(StandardOutput(outputNumbers, outputChars)),
           input(PipeInput(inputChars, rawInput))
     { 
       // Fills rams with contents of files.
       for (size_t i = 0; i < filenamesIn.size(); i++) {
-        Load::fillRamWithFile(filenamesIn[i].c_str(), computerChain[i].ram);
+        Load::fillRamWithFile(filenamesIn[i].c_str(),
+                              computerChain[i].computer.ram);
+        computerChain[i].setName("computer " + to_string(i + 1) + " (" +
+                                 filenamesIn[i] + ")");
       }
       // Connects input, computers and output into chain.
-      computerChain[0].ram.input = &input;
+      computerChain[0].computer.ram.input = &input;
       for (size_t i = 1; i < computerChain.size(); i++) {
-        computerChain[i].ram.input = &computerChain[i-1];
+        computerChain[i].computer.ram.input = &computerChain[i-1];
       }
       output.input = &computerChain.back();
+      for (TieredComputer &computer : computerChain) {
+        computer.evaluateUntilInput();
+      }
     }
 
     void run();
 
   private:
-    vector<Computer> computerChain;
+    vector<TieredComputer> computerChain;
     StandardOutput output;
     PipeInput input;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "output.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <numeric>
@@ -9,9 +10,12 @@
 #include <stdio.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <unistd.h>
+#include <map>
 #include <string>
 #include <vector>
 
+#include "allocation_stats.hpp"
 #include "const.hpp"
 
 ////// PRIVATE ///////
@@ -20,16 +24,17 @@ void registerSigWinChCatcher(void);
 void sigWinChCatcher(int signum);
 void updateConsoleSize(void);
 void updateScreenAndPrintChanges();
-void printLine(vector<string> lineVec, int lineNo);
+void appendAttrChange(string &out, int from, int to);
+void writeAll(const string &out);
+void printEscape(const char *escSeq);
+void recordOutput(const string &out);
 int getAbsoluteX(int x);
 int getAbsoluteY(int y);
 int getAbsoluteCoordinate(int value, int console, int track);
 int coordinatesOutOfBounds(int x, int y);
-vector<string> resizeLine(vector<string> line, int size);
-bool isEscSeqence(vector<string> line, vector<string> seqence, int index);
-int insertEscSeqAndReturnLength(vector<string> &lineOut, 
-                                vector<string> const &escSeq);
-void setBufferLine(vector<string> line, int y);
+bool resizeGrids();
+bool outputBacklogged();
+string getSkippedFramesIndicator();
 
 ////////////////////////////
 
@@ -46,23 +51,86 @@ int columnsLast = columns;
 int rowsLast = rows;
 
 callback_function updateBuffer;
+hash_function getStateHash;
 volatile sig_atomic_t screenResized = 0;
 
-vector<vector<string>> buffer;
-vector<vector<string>> screen;
+/*
+ * Screen is represented as a grid of cells, each holding an id of a glyph
+ * and attributes (highlighted and bright). Buffer holds the next frame, and
+ * screen what is currently on the terminal, so only the cells that differ
+ * get printed.
+ */
+int gridWidth = 0;
+int gridHeight = 0;
+vector<Cell> buffer;
+vector<Cell> screen;
+// Changes get collected here before they are written. It is kept between
+// the frames, so it doesn't need to be allocated again.
+string changes;
+
+/*
+ * Terminal can print slower than frames are coming (ssh, linux console).
+ * Instead of blocking on writes, frames then get skipped, so only the
+ * latest state gets drawn once terminal catches up.
+ */
+chrono::steady_clock::time_point lastWriteStart;
+chrono::steady_clock::time_point lastWriteEnd;
+chrono::steady_clock::time_point lastSkip;
+int framesSkipped = 0;
+
+/*
+ * Frame gets rendered only if the state that it depends on changed since
+ * the last one (or the screen got resized or cleared).
+ */
+size_t lastStateHash = 0;
+string lastIndicator;
+
+/*
+ * In headless mode output goes to a virtual terminal of fixed size instead
+ * of stdout. Its contents are the screen grid, so the bytes only get
+ * counted. Stats get collected in both modes.
+ */
+bool headless = false;
+int headlessColumns = 0;
+int headlessRows = 0;
+RenderStats renderStats;
 
 ///////////////////////////////
 ////////// INTERFACE //////////
 ///////////////////////////////
 
-void initOutput(callback_function updateBufferThat, int width, int height) {
+void initOutput(callback_function updateBufferThat,
+                hash_function getStateHashThat, int width, int height) {
   updateBuffer = updateBufferThat;
+  getStateHash = getStateHashThat;
   pictureWidth = width;
   pictureHeight = height;
   registerSigWinChCatcher();
   updateConsoleSize();
   // Sets colors.
-  printf("\e[37m\e[40m");
+  printEscape("\e[37m\e[40m");
+}
+
+void initHeadlessOutput(callback_function updateBufferThat,
+                        hash_function getStateHashThat, int width, int height,
+                        int columnsIn, int rowsIn) {
+  headless = true;
+  headlessColumns = columnsIn;
+  headlessRows = rowsIn;
+  updateBuffer = updateBufferThat;
+  getStateHash = getStateHashThat;
+  pictureWidth = width;
+  pictureHeight = height;
+  updateConsoleSize();
+  printEscape("\e[37m\e[40m");
+}
+
+RenderStats getRenderStats() {
+  return renderStats;
+}
+
+void resetRenderStats() {
+  renderStats = RenderStats();
 }
 
 void redrawScreen() {
@@ -71,24 +139,68 @@ void redrawScreen() {
   if (columnsLast != columns || rowsLast != rows) {
     clearScreen();
   }
+  bool gridsResized = resizeGrids();
+  size_t stateHash = getStateHash();
+  string indicator = getSkippedFramesIndicator();
+  bool frameChanged = gridsResized || stateHash != lastStateHash ||
+                      indicator != lastIndicator;
+  if (!frameChanged) {
+    return;
+  }
+  lastStateHash = stateHash;
+  lastIndicator = indicator;
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  size_t allocationsAtStart = AllocationStats::getCount();
   updateBuffer();
-  updateScreenAndPrintChanges();
+  for (int x = 0; x < (int) indicator.size() && x < gridWidth; x++) {
+    buffer[x] = { GlyphTable::getGlyph(indicator[x]), HIGHLIGHTED };
+  }
   fflush(stdout);
+  updateScreenAndPrintChanges();
+  renderStats.frames++;
+  renderStats.renderTime += chrono::steady_clock::now() - start;
+  renderStats.allocations += AllocationStats::getCount() - allocationsAtStart;
+}
+
+/*
+ * Returns false and skips the frame if terminal is still busy printing the
+ * previous ones. Caller should try again later, so the last state gets
+ * drawn eventually.
+ */
+bool redrawScreenIfReady() {
+  if (outputBacklogged()) {
+    framesSkipped++;
+    lastSkip = chrono::steady_clock::now();
+    return false;
+  }
+  redrawScreen();
+  return true;
 }
 
 void clearScreen(void) {
-  screen = vector<vector<string>>();
-  buffer = vector<vector<string>>();
-  printf("\e[1;1H\e[2J");
+  screen = vector<Cell>();
+  buffer = vector<Cell>();
+  gridWidth = 0;
+  gridHeight = 0;
+  printEscape("\e[1;1H\e[2J");
 }
 
-void replaceBufferLine(vector<string> line, int y) {
+/*
+ * Stores the line of cells in the buffer. Cells past the end of the line
+ * get emptied.
+ */
+void replaceBufferLine(const vector<Cell> &line, int y) {
   int x = 0;
-  if (coordinatesOutOfBounds(x, y)) {
+  if (coordinatesOutOfBounds(x, y) || y >= gridHeight) {
     return;
   }
-  line = resizeLine(line, columns - x - 1);
-  setBufferLine(line, y);
+  Cell *row = &buffer[y * gridWidth];
+  for (; x < (int) line.size() && x < gridWidth; x++) {
+    row[x] = line[x];
+  }
+  for (; x < gridWidth; x++) {
+    row[x] = EMPTY_CELL;
+  }
 }
 
 /////////////////////////////
@@ -116,33 +228,100 @@ void sigWinChCatcher(int signum) {
  * Asks system about window size.
  */
 void updateConsoleSize() {
+  columnsLast = columns;
+  rowsLast = rows;
+  if (headless) {
+    columns = headlessColumns;
+    rows = headlessRows;
+    return;
+  }
   struct winsize w;
   ioctl(0, TIOCGWINSZ, &w);
-  columnsLast = columns;
   columns = w.ws_col;
-  rowsLast = rows;
   rows = w.ws_row;
 }
 
 /// UPDATE SCREEN AND PRINT CHANGES ///
 
+/*
+ * Compares buffer with the screen cell by cell, and prints only the cells
+ * that changed. Cursor gets moved only when changed cells are not adjacent,
+ * and attributes get set only when they differ from the previous printed
+ * cell. Whole frame is written with a single write.
+ */
 void updateScreenAndPrintChanges() {
-  for (size_t i = 0; i < buffer.size(); i++) {
-    if (screen.size() <= i) {
-      screen.push_back({});
-      printLine(buffer.at(i), i);
-    } else if (buffer.at(i) != screen.at(i)) {
-      screen.at(i) = buffer.at(i);
-      printLine(buffer.at(i), i);
+  string &out = changes;
+  out.clear();
+  int attrs = 0;
+  int cursorX = -1;
+  int cursorY = -1;
+  for (int y = 0; y < gridHeight; y++) {
+    for (int x = 0; x < gridWidth; x++) {
+      int i = y * gridWidth + x;
+      if (!(buffer[i] != screen[i])) {
+        continue;
+      }
+      if (x != cursorX || y != cursorY) {
+        char move[32];
+        snprintf(move, sizeof(move), "\033[%d;%dH", getAbsoluteY(y),
+                 getAbsoluteX(x));
+        out += move;
+      }
+      appendAttrChange(out, attrs, buffer[i].attrs);
+      attrs = buffer[i].attrs;
+      out += GlyphTable::getString(buffer[i].glyph);
+      screen[i] = buffer[i];
+      renderStats.cellsChanged++;
+      cursorX = x + 1;
+      cursorY = y;
     }
   }
+  appendAttrChange(out, attrs, 0);
+  writeAll(out);
 }
 
-void printLine(vector<string> lineVec, int lineNo) {
-  string line = accumulate(lineVec.begin(), lineVec.end(), string(""));
-  string controlSeq = "\033[" + to_string(getAbsoluteY(lineNo)) + ";" + 
-                      to_string(getAbsoluteX(0)) + "H" + line;
-  cout << controlSeq;
+void appendAttrChange(string &out, int from, int to) {
+  int changed = from ^ to;
+  if (changed & HIGHLIGHTED) {
+    out += (to & HIGHLIGHTED) ? HIGHLIGHT_ESC : HIGHLIGHT_END_ESC;
+  }
+  if (changed & (BRIGHT | HEAT)) {
+    out += (to & BRIGHT) ? BRIGHT_ESC : HEAT_ESC[(to & HEAT) >> HEAT_SHIFT];
+  }
+}
+
+void writeAll(const string &out) {
+  recordOutput(out);
+  if (headless) {
+    return;
+  }
+  lastWriteStart = chrono::steady_clock::now();
+  size_t written = 0;
+  while (written < out.size()) {
+    ssize_t res = write(STDOUT_FILENO, out.c_str() + written,
+                        out.size() - written);
+    if (res <= 0) {
+      return;
+    }
+    written += res;
+  }
+  lastWriteEnd = chrono::steady_clock::now();
+}
+
+/*
+ * Escape sequences that are not part of a frame get printed with printf,
+ * so they stay in order with the rest of the buffered stdout.
+ */
+void printEscape(const char *escSeq) {
+  recordOutput(escSeq);
+  if (!headless) {
+    printf("%s", escSeq);
+  }
+}
+
+void recordOutput(const string &out) {
+  renderStats.bytes += out.size();
+  renderStats.escapeSequences += count(out.begin(), out.end(), '\033');
 }
 
 int getAbsoluteX(int x) {
@@ -170,71 +349,57 @@ int coordinatesOutOfBounds(int x, int y) {
   return x >= columns || y >= rows || x < 0 || y < 0;
 }
 
-vector<string> resizeLine(vector<string> line, int size) {
-  if (size < 1) {
-    return vector<string>();
-  }
-  vector<string> lineOut;
-  bool insideHighlightedText = false;
-  bool insideBrightText = false;
-  int counter = 0;
-  for (size_t i = 0; i < line.size(); i++) {
-    if (line[i] == ESCAPE) {
-      if (isEscSeqence(line, HIGHLIGHT_ESC_VEC, i)) {
-        i += insertEscSeqAndReturnLength(lineOut, HIGHLIGHT_ESC_VEC);
-        insideHighlightedText = true;
-        continue;
-      } else if (isEscSeqence(line, HIGHLIGHT_END_ESC_VEC, i)) {
-        i += insertEscSeqAndReturnLength(lineOut, HIGHLIGHT_END_ESC_VEC);
-        insideHighlightedText = false;
-        continue;
-      } else if (isEscSeqence(line, BRIGHT_ESC_VEC, i)) {
-        i += insertEscSeqAndReturnLength(lineOut, BRIGHT_ESC_VEC);
-        insideBrightText = true;
-        continue;
-      } else if (isEscSeqence(line, BRIGHT_END_ESC_VEC, i)) {
-        i += insertEscSeqAndReturnLength(lineOut, BRIGHT_END_ESC_VEC);
-        insideBrightText = false;
-        continue;
-      }
-    }
-    if (counter++ == size+1) {
-      if  (insideHighlightedText) {
-        lineOut.insert(lineOut.end(), HIGHLIGHT_END_ESC_VEC.begin(), 
-                       HIGHLIGHT_END_ESC_VEC.end());
-      }
-      if  (insideBrightText) {
-        lineOut.insert(lineOut.end(), BRIGHT_END_ESC_VEC.begin(), 
-                       BRIGHT_END_ESC_VEC.end());
-      }
-      return lineOut;
-    }
-    lineOut.push_back(line[i]);
-  }
-  return lineOut;
-}
+/// SKIPPING FRAMES ///
 
-bool isEscSeqence(vector<string> line, vector<string> seqence, int index) {
-  bool lineTooShort = line.size() < index + seqence.size();
-  if (lineTooShort) {
+/*
+ * Bytes in the output queue are only known for real terminals (not for
+ * pseudo terminals, like the ones used by ssh). There, if writing took too
+ * long, we give terminal the same amount of time to catch up.
+ */
+bool outputBacklogged() {
+  if (headless) {
     return false;
   }
-  return equal(seqence.begin(), seqence.end(), line.begin()+index);
+  int pending = 0;
+  if (ioctl(STDOUT_FILENO, TIOCOUTQ, &pending) == 0 &&
+      pending > MAX_PENDING_OUTPUT) {
+    return true;
+  }
+  chrono::steady_clock::duration writeDuration = lastWriteEnd -
+                                                 lastWriteStart;
+  bool writeWasSlow = writeDuration > chrono::milliseconds(500 / FRAME_RATE);
+  return writeWasSlow &&
+         chrono::steady_clock::now() < lastWriteEnd + writeDuration;
 }
 
-int insertEscSeqAndReturnLength(vector<string> &lineOut, 
-                                vector<string> const &escSeq) {
-  lineOut.insert(lineOut.end(), escSeq.begin(), 
-                 escSeq.end());
-  return escSeq.size()-1;
+/*
+ * Returns text that gets drawn over the top left corner of the picture, or
+ * empty string if no frames were skipped recently. Count starts from zero
+ * again once a frame gets drawn without skipping for a second.
+ */
+string getSkippedFramesIndicator() {
+  bool skippedRecently = framesSkipped > 0 &&
+      chrono::steady_clock::now() - lastSkip < chrono::seconds(1);
+  if (!skippedRecently) {
+    framesSkipped = 0;
+  }
+  if (!skippedRecently || gridHeight == 0) {
+    return "";
+  }
+  return FRAMES_SKIPPED_INDICATOR + to_string(framesSkipped) + " ";
 }
 
-void setBufferLine(vector<string> line, int y) {
-  int size = buffer.size();
-  if (size <= y) {
-    for (int i = size; i <= y+1; i++) {
-      buffer.push_back({});
-    }
+/*
+ * Grids cover the whole console. Screen starts empty, because it gets
+ * resized only after it was cleared.
+ */
+bool resizeGrids() {
+  if (gridWidth == columns && gridHeight == rows) {
+    return false;
   }
-  buffer.at(y) = line;
+  gridWidth = max(columns, 0);
+  gridHeight = max(rows, 0);
+  buffer = vector<Cell>(gridWidth * gridHeight, EMPTY_CELL);
+  screen = vector<Cell>(gridWidth * gridHeight, EMPTY_CELL);
+  return true;
 }
@@ -1,19 +1,43 @@
 #ifndef OUTPUT_H
 #define OUTPUT_H
 
+#include <chrono>
 #include <string>
 #include <vector>
 
 #include <signal.h>
 
+#include "glyph.hpp"
+
 using namespace std;
 
 typedef void (*callback_function)(void);
+typedef size_t (*hash_function)(void);
+
+/*
+ * What the output sent to the terminal, summed over all rendered frames.
+ */
+struct RenderStats {
+  size_t frames = 0;
+  size_t bytes = 0;
+  size_t escapeSequences = 0;
+  size_t cellsChanged = 0;
+  // Only counted in 'make bench' builds (see AllocationStats).
+  size_t allocations = 0;
+  chrono::nanoseconds renderTime = chrono::nanoseconds(0);
+};
 
-void initOutput(callback_function drawScreen, int width, int height);
+void initOutput(callback_function drawScreen, hash_function getStateHash,
+                int width, int height);
+void initHeadlessOutput(callback_function drawScreen,
+                        hash_function getStateHash, int width, int height,
+                        int columnsIn, int rowsIn);
+RenderStats getRenderStats();
+void resetRenderStats();
 void redrawScreen();
+bool redrawScreenIfReady();
 void clearScreen();
-void replaceBufferLine(vector<string> s, int y);
+void replaceBufferLine(const vector<Cell> &line, int y);
 
 extern volatile sig_atomic_t screenResized;
  
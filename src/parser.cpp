@@ -6,14 +6,16 @@
 
 #include "const.hpp"
 #include "environment_const_string.hpp"
+#include "cpu.hpp"
 #include "instruction.hpp"
 #include "load.hpp"
+#include "partial_evaluator.hpp"
 #include "ram.hpp"
 
 using namespace std;
 
-string Parser::parse(vector<string> filenamesIn, bool outputChars, 
-                     bool inputChars, bool rawInput) {
+string Parser::parse(vector<string> filenamesIn, bool outputChars,
+                     bool inputChars, bool rawInput, bool threads) {
   vector<Ram> rams = vector<Ram>(filenamesIn.size());
   // Fills rams with contents of files.
   for (size_t i = 0; i < filenamesIn.size(); i++) {
@@ -25,6 +27,9 @@ string Parser::parse(vector<string> filenamesIn, bool outputChars,
                                     environmentConstString.end(), string(""));
     source += environment;
   }
+  if (threads) {
+    source += SOURCE_THREADS_INCLUDES + "\n\n";
+  }
   source += SOURCE_HEADER + "\n\n";
   if (rawInput) {
     source += PRINT_RAW + "\n\n";
@@ -33,6 +38,11 @@ string Parser::parse(vector<string> filenamesIn, bool outputChars,
   } else {
     source += PRINT_BASIC + "\n\n";
   }
+  if (threads) {
+    source += SOURCE_THREADS_RUNTIME + "\n\n";
+  } else {
+    source += END_OF_INPUT + "\n\n";
+  }
   if (rawInput) {
     source += F0_RAW + "\n\n";
   } else if (inputChars) {
@@ -41,7 +51,11 @@ string Parser::parse(vector<string> filenamesIn, bool outputChars,
     source += F0_BASIC + "\n\n";
   }
   for (size_t i = 0; i < filenamesIn.size(); i++) {
-    source += getComputerFunction(rams[i], i)+ "\n\n";
+    source += getComputerFunction(rams[i], i, threads)+ "\n\n";
+  }
+  if (threads) {
+    source += getThreadsFooter(filenamesIn.size(), rawInput) + "\n";
+    return source;
   }
   if (rawInput) {
     source += SOURCE_FOOTER_1_RAW;
@@ -53,21 +67,79 @@ string Parser::parse(vector<string> filenamesIn, bool outputChars,
   return source;
 }
 
-string Parser::getComputerFunction(Ram ram, int index) {
+/*
+ * Part of the program that runs before the first read from the input gets
+ * evaluated here. Function then starts in the resulting state and first
+ * returns the words that were output during that time.
+ */
+string Parser::getComputerFunction(Ram ram, int index, bool threads) {
+  Cpu cpu = Cpu(ram);
+  vector<vector<bool>> prefix = PartialEvaluator::evaluate(ram, cpu);
   string function;
-  function += getFunctionHeader(ram.state[DATA], index)+ "\n";
+  function += getFunctionHeader(ram.state[DATA], cpu, index, threads);
+  if (!prefix.empty()) {
+    function += SOURCE_FUNCTION_PREFIX_1 + getData(prefix) +
+                SOURCE_FUNCTION_PREFIX_2;
+  }
+  function += SOURCE_FUNCTION_START + "\n";
   for (size_t i = 0; i < RAM_SIZE; i++) {
-    function += getLineOfCode(ram.state[CODE][i], i, ram) + "\n";
+    function += getLineOfCode(ram.state[CODE][i], i) + "\n";
+  }
+  if (threads) {
+    function += SOURCE_FUNCTION_FOOTER_THREADS;
+  } else {
+    function += SOURCE_FUNCTION_FOOTER;
   }
-  function += SOURCE_FUNCTION_FOOTER;
   return function;
 }
 
-string Parser::getFunctionHeader(vector<vector<bool>> data, int index) {
-  return SOURCE_FUNCTION_HEADER_1 + to_string(index+1) + 
-         SOURCE_FUNCTION_HEADER_2 + to_string(index) +
-         SOURCE_FUNCTION_HEADER_3 + getData(data) +
-         SOURCE_FUNCTION_HEADER_4;
+/*
+ * In threaded mode predecesor pops from the ring that holds output of
+ * the previous stage, instead of calling its function directly.
+ */
+string Parser::getFunctionHeader(vector<vector<bool>> data, const Cpu &cpu,
+                                 int index, bool threads) {
+  string predecesor;
+  if (threads) {
+    predecesor = "pop<" + to_string(index) + ">";
+  } else {
+    predecesor = "f" + to_string(index);
+  }
+  return SOURCE_FUNCTION_HEADER_1 + to_string(index+1) +
+         SOURCE_FUNCTION_HEADER_2 + predecesor +
+         SOURCE_FUNCTION_HEADER_3 + to_string(Util::getInt(cpu.getRegister())) +
+         SOURCE_FUNCTION_HEADER_4 + to_string(Util::getInt(cpu.getPc())) +
+         SOURCE_FUNCTION_HEADER_5 + getData(data) +
+         SOURCE_FUNCTION_HEADER_6;
+}
+
+/*
+ * Source of a shared library with a single function, that continues
+ * execution of the program from the passed state (see NativeStage).
+ */
+string Parser::getNativeStage(Ram &ram) {
+  string source = SOURCE_INCLUDES + "\n\n" + SOURCE_HEADER + "\n\n" +
+                  NATIVE_STAGE_HEADER + "\n";
+  for (size_t i = 0; i < RAM_SIZE; i++) {
+    source += getLineOfCode(ram.state[CODE][i], i) + "\n";
+  }
+  return source + NATIVE_STAGE_FOOTER + "\n";
+}
+
+string Parser::getThreadsFooter(int numOfComputers, bool rawInput) {
+  string footer;
+  if (rawInput) {
+    footer += SOURCE_THREADS_FOOTER_1_RAW;
+  } else {
+    footer += SOURCE_THREADS_FOOTER_1;
+  }
+  for (int i = 0; i <= numOfComputers; i++) {
+    if (i > 0) {
+      footer += ", ";
+    }
+    footer += "&f" + to_string(i);
+  }
+  return footer + SOURCE_THREADS_FOOTER_2;
 }
 
 string Parser::getData(vector<vector<bool>> data) {
@@ -84,8 +156,12 @@ string Parser::getData(vector<vector<bool>> data) {
   return out;
 }
 
-string Parser::getLineOfCode(vector<bool> word, int index, Ram ram) {
-  Instruction inst = Instruction(word, EMPTY_WORD, &ram);
+/*
+ * Instruction gets decoded without the ram, so that pointers don't read
+ * from the input.
+ */
+string Parser::getLineOfCode(vector<bool> word, int index) {
+  Instruction inst = Instruction(word, EMPTY_WORD, NULL);
   string strIndex;
   if (index < 10) {
     strIndex = "0";
@@ -93,4 +169,4 @@ string Parser::getLineOfCode(vector<bool> word, int index, Ram ram) {
   strIndex += to_string(index);
   string instCode = inst.getCode(index+1);
   return "  a" + strIndex + ": " + instCode;
-}
\ No newline at end of file
+}
\ No newline at end of file
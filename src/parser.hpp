@@ -6,17 +6,21 @@
 
 using namespace std;
 
+class Cpu;
 class Ram;
 
 class Parser {
   public:
-    static string parse(vector<string> filenamesIn, bool outputChars, 
-                        bool inputChars, bool rawInput);
+    static string parse(vector<string> filenamesIn, bool outputChars,
+                        bool inputChars, bool rawInput, bool threads);
+    static string getNativeStage(Ram &ram);
   private:
-    static string getComputerFunction(Ram ram, int index);
-    static string getFunctionHeader(vector<vector<bool>> data, int index);
+    static string getComputerFunction(Ram ram, int index, bool threads);
+    static string getFunctionHeader(vector<vector<bool>> data,
+                                    const Cpu &cpu, int index, bool threads);
+    static string getThreadsFooter(int numOfComputers, bool rawInput);
     static string getData(vector<vector<bool>> data);
-    static string getLineOfCode(vector<bool> word, int index, Ram ram);
+    static string getLineOfCode(vector<bool> word, int index);
 };
 
 #endif
@@ -0,0 +1,59 @@
+#include "partial_evaluator.hpp"
+
+#include <map>
+#include <vector>
+
+#include "const.hpp"
+#include "cpu.hpp"
+#include "fast_cpu.hpp"
+#include "provides_output.hpp"
+#include "ram.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+/*
+ * Input that only remembers that somebody tried to read from it.
+ */
+class InputBarrier : public ProvidesOutput {
+  public:
+    bool reached = false;
+    vector<bool> getOutput() {
+      reached = true;
+      return EMPTY_WORD;
+    }
+};
+
+/*
+ * Executes program until it tries to read from the input, reaches the last
+ * address, or the limit of cycles or output words is reached. Ram and cpu
+ * are left in the state before the instruction that would read the input,
+ * so execution can be continued from there. Returns the words that were
+ * written to the output in the meantime.
+ */
+vector<vector<bool>> PartialEvaluator::evaluate(Ram &ram, Cpu &cpu) {
+  vector<vector<bool>> output;
+  InputBarrier barrier;
+  FastCpu fastCpu;
+  fastCpu.load(ram, cpu);
+  fastCpu.input = &barrier;
+  for (int i = 0; i < PARTIAL_EVALUATION_CYCLES; i++) {
+    if (output.size() >= PARTIAL_EVALUATION_OUTPUTS) {
+      break;
+    }
+    FastCpu lastState = fastCpu;
+    int out = fastCpu.run(1);
+    if (barrier.reached) {
+      fastCpu = lastState;
+      break;
+    }
+    if (out == FastCpu::END) {
+      break;
+    }
+    if (out != FastCpu::PAUSED) {
+      output.push_back(Util::getBoolByte(out));
+    }
+  }
+  fastCpu.store(ram, cpu);
+  return output;
+}
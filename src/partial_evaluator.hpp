@@ -0,0 +1,16 @@
+#ifndef PARTIAL_EVALUATOR_H
+#define PARTIAL_EVALUATOR_H
+
+#include <vector>
+
+using namespace std;
+
+class Cpu;
+class Ram;
+
+class PartialEvaluator {
+  public:
+    static vector<vector<bool>> evaluate(Ram &ram, Cpu &cpu);
+};
+
+#endif
@@ -1,7 +1,10 @@
 #include "printer.hpp"
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "const.hpp"
@@ -9,6 +12,11 @@
 
 using namespace std;
 
+const string PAPER_EDGE = "|0|______________|0|";
+const string EMPTY_PAPER = string(PAPER_EDGE.size(), ' ');
+
+size_t Printer::nextPaperId = 0;
+
 /// INTERFACE ///
 
 void Printer::run() {
@@ -26,25 +34,77 @@ void Printer::run() {
   }
 }
 
-string Printer::getPrinterOutput() const {
-  if (!printerOutputUpdated) {
-    printerOutput = renderPrinterOutput();
-    printerOutputUpdated = true;
-  }
-  return printerOutput;
+/*
+ * Returns i-th character of the paper as it is seen in the printer, with
+ * the last printed line on the top and the edge of the paper below the
+ * first one. Lines don't have line breaks, so view can wrap the paper
+ * around its slots. Doesn't render anything, so the cost doesn't depend on
+ * the length of the output.
+ */
+char Printer::getPaperChar(size_t i) const {
+  size_t width = PAPER_EDGE.size();
+  return getPaperLine(i / width).at(i % width);
 }
 
 void Printer::printString(string sIn) {
-  string sOut;
+  vector<string> chunks;
   while (sIn.size() > PRINTER_WIDTH) {
-    sOut.insert(0, sIn.substr(0, PRINTER_WIDTH) + "\n");
+    chunks.push_back(sIn.substr(0, PRINTER_WIDTH));
     sIn = sIn.substr(PRINTER_WIDTH, sIn.length());
   }
   if (sIn.length() > 0) {
-    sOut.insert(0, sIn.append(PRINTER_WIDTH-sIn.length(),' ') + "\n");
+    chunks.push_back(sIn.append(PRINTER_WIDTH-sIn.length(),' '));
+  }
+  // Paper is read from the top, where the last line is.
+  for (auto it = chunks.rbegin(); it != chunks.rend(); it++) {
+    printLine(*it);
+  }
+}
+
+/*
+ * Positive delta scrolls towards the older lines.
+ */
+void Printer::scroll(int delta) {
+  int maxScrolled = max((int) lines.size() - 1, 0);
+  size_t scrolledLast = scrolled;
+  scrolled = min(max((int) scrolled + delta, 0), maxScrolled);
+  if (scrolled != scrolledLast) {
+    revision++;
   }
-  output += sOut;
-  printerOutputUpdated = false;
+}
+
+/*
+ * Makes this paper a copy of the other one, without its last
+ * 'linesRemoved' lines (used for showing the paper as it was at an earlier
+ * cycle). If this is already a copy of the same paper, only the lines that
+ * changed since the last copy get copied, so copying a frame doesn't cost
+ * more with longer output.
+ */
+void Printer::copyPaper(const Printer &other, size_t linesRemoved) {
+  size_t count = other.lines.size() - min(linesRemoved, other.lines.size());
+  size_t end = other.firstLine + count;
+  bool samePaper = paperId == other.paperId && firstLine <= other.firstLine &&
+                   firstLine + lines.size() >= other.firstLine;
+  if (samePaper) {
+    while (firstLine < other.firstLine) {
+      lines.pop_front();
+      firstLine++;
+    }
+    while (firstLine + lines.size() > end) {
+      lines.pop_back();
+    }
+    for (size_t i = firstLine + lines.size(); i < end; i++) {
+      lines.push_back(other.lines[i - other.firstLine]);
+    }
+  } else {
+    copyAllLines(other, count);
+  }
+  scrolled = other.scrolled > linesRemoved ? other.scrolled - linesRemoved : 0;
+  revision = other.revision + (linesRemoved > 0 ? 1 : 0);
+}
+
+size_t Printer::getRevision() const {
+  return revision;
 }
 
 /// PRIVATE ///
@@ -57,34 +117,60 @@ void Printer::printString(string sIn) {
  * add the decimal representation.
  */
 void Printer::print(vector<bool> wordIn) {
-  output += Util::getStringWithFormatedInt(wordIn);
-  printerOutputUpdated = false;
+  string line = Util::getStringWithFormatedInt(wordIn);
+  line.pop_back();
+  printLine(line);
 }
 
 void Printer::printEmptyLine() {
-  output += "            \n";
+  printLine(string(PRINTER_WIDTH, ' '));
 }
 
-string Printer::getOutput() {
-  return output;
+/*
+ * Frames the line and appends it. Oldest line gets dropped when history is
+ * full. If paper is scrolled, the view stays on the same lines.
+ */
+void Printer::printLine(string line) {
+  lines.push_back(make_shared<const string>("|0| " + line + " |0|"));
+  revision++;
+  if (scrolled > 0) {
+    scrolled++;
+  }
+  if (lines.size() > PRINTER_HISTORY) {
+    lines.pop_front();
+    firstLine++;
+    scrolled = min(scrolled, lines.size() - 1);
+  }
 }
 
 void Printer::clear() {
-  output = "";
-  printerOutputUpdated = false;
+  lines.clear();
+  paperId = nextPaperId++;
+  firstLine = 0;
+  scrolled = 0;
+  revision++;
 }
 
-string Printer::renderPrinterOutput() const {
-  if (output.length() <= 0) {
-    return "|0|______________|0|";
+/*
+ * Copies only the pointers to the first 'count' lines.
+ */
+void Printer::copyAllLines(const Printer &other, size_t count) {
+  lines.assign(other.lines.begin(), other.lines.begin() + count);
+  paperId = other.paperId;
+  firstLine = other.firstLine;
+}
+
+/*
+ * Returns i-th line from the top of the visible part of the paper.
+ */
+const string &Printer::getPaperLine(size_t i) const {
+  i += scrolled;
+  if (i < lines.size()) {
+    return *lines[lines.size() - 1 - i];
   }
-  vector<string> lines = Util::splitString(output);
-  reverse(lines.begin(), lines.end());
-  vector<string>  outputLines;
-  for (string line : lines) {
-    outputLines.push_back("|0| " + line + " |0|");
+  if (i == lines.size()) {
+    return PAPER_EDGE;
   }
-  outputLines.push_back("|0|______________|0|");
-  return Util::makeString(outputLines);
+  return EMPTY_PAPER;
 }
 
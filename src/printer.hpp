@@ -1,6 +1,8 @@
 #ifndef PRINTER_H
 #define PRINTER_H
 
+#include <deque>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,27 +16,45 @@ class Printer {
             void (*sleepAndCheckForKeyIn)(void)) 
         : input(inputIn),
           printState(printStateIn),
-          sleepAndCheckForKey(sleepAndCheckForKeyIn) { }
+          sleepAndCheckForKey(sleepAndCheckForKeyIn),
+          paperId(nextPaperId++) { }
 
     /// INTERFACE ///
     void run();
-    string getPrinterOutput() const;
+    char getPaperChar(size_t i) const;
     void printString(string sIn);
+    void scroll(int delta);
+    void copyPaper(const Printer &other, size_t linesRemoved = 0);
+    void clear();
+    size_t getRevision() const;
 
   private:
     ProvidesOutput &input;
     void (*printState)(void);
     void (*sleepAndCheckForKey)(void);
-    string output;
-    mutable string printerOutput;
-    mutable bool printerOutputUpdated = false;
+    // Lines of the paper, already framed, in the order they were printed.
+    // They never change, so copies of the paper share them.
+    deque<shared_ptr<const string>> lines;
+    // Paper that the lines come from. It changes only when paper gets
+    // cleared (or replaced by the copy of a different paper), so lines with
+    // the same number are the same on all the copies with the same id.
+    size_t paperId;
+    // Number of lines that were printed on this paper before the first one
+    // in the deque (they were dropped because of the history limit).
+    size_t firstLine = 0;
+    // Number of most recent lines that are scrolled out of the view.
+    size_t scrolled = 0;
+    // Gets increased whenever visible part of the paper changes.
+    size_t revision = 0;
 
     /// PRIVATE ///
     void print(vector<bool> sIn);
     void printEmptyLine();
-    string getOutput();
-    void clear();
-    string renderPrinterOutput() const;
+    void printLine(string line);
+    const string &getPaperLine(size_t i) const;
+    void copyAllLines(const Printer &other, size_t count);
+
+    static size_t nextPaperId;
 };
 
 #endif
\ No newline at end of file
@@ -54,6 +54,36 @@ string Ram::stateToString(map<AddrSpace, vector<vector<bool>>> state) {
   return out;
 }
 
+RamImage Ram::getImage() const {
+  RamImage image;
+  for (AddrSpace space : { CODE, DATA }) {
+    const vector<vector<bool>> &words = state.at(space);
+    for (int i = 0; i < RAM_SIZE; i++) {
+      uint8_t value = 0;
+      for (bool bit : words[i]) {
+        value = (value << 1) | bit;
+      }
+      image[space * RAM_SIZE + i] = value;
+    }
+  }
+  return image;
+}
+
+/*
+ * Only overwrites the bits, so words keep their storage.
+ */
+void Ram::setImage(const RamImage &image) {
+  for (AddrSpace space : { CODE, DATA }) {
+    vector<vector<bool>> &words = state[space];
+    for (int i = 0; i < RAM_SIZE; i++) {
+      uint8_t value = image[space * RAM_SIZE + i];
+      for (int bit = WORD_SIZE - 1; bit >= 0; bit--, value >>= 1) {
+        words[i][bit] = value & 1;
+      }
+    }
+  }
+}
+
 /// PRIVATE ///
 
 vector<bool> Ram::getLastAddress(AddrSpace addrSpace) const {
@@ -1,6 +1,9 @@
 #ifndef RAM_H
 #define RAM_H
 
+#include <stdint.h>
+
+#include <array>
 #include <vector>
 #include <map>
 
@@ -12,6 +15,13 @@ using namespace std;
 class Address;
 class ProvidesOutput;
 
+/*
+ * Values of all the words, code space first, one byte per word. Taking it
+ * and restoring it doesn't allocate, so it is used for saving the state of
+ * the ram before the execution, and by the edit history.
+ */
+typedef array<uint8_t, 2 * RAM_SIZE> RamImage;
+
 class Ram {
   public:
     // Initializes the state, one per address space.
@@ -28,6 +38,8 @@ class Ram {
     vector<bool> get(const Address &adr) const;
     void set(const Address &adr, const vector<bool> &wordIn);
     string getString() const;
+    RamImage getImage() const;
+    void setImage(const RamImage &image);
     static string stateToString(map<AddrSpace, vector<vector<bool>>> state);
 
   private:
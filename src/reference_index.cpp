@@ -0,0 +1,110 @@
+#include "reference_index.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "const.hpp"
+#include "decode_table.hpp"
+#include "ram.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+/////////////////
+/// INTERFACE ///
+/////////////////
+
+/*
+ * Reindexes the code words that changed since the last update.
+ */
+void ReferenceIndex::update(const Ram &ram) {
+  const vector<vector<bool>> &code = ram.state.at(CODE);
+  for (int i = 0; i < RAM_SIZE; i++) {
+    int word = Util::getInt(code.at(i));
+    if (word != words[i]) {
+      setWord(i, word);
+    }
+  }
+}
+
+/*
+ * When the last non-empty instruction changes, the empty instructions
+ * between the old and the new one get added or removed.
+ */
+void ReferenceIndex::setWord(int index, int word) {
+  if (index <= lastNonEmptyInst) {
+    remove(index);
+  }
+  words[index] = word;
+  int last = lastNonEmptyInst;
+  if (word != 0 && index > last) {
+    last = index;
+  } else if (word == 0 && index == last) {
+    while (last >= 0 && words[last] == 0) {
+      last--;
+    }
+  }
+  for (int i = lastNonEmptyInst + 1; i <= last; i++) {
+    if (i != index) {
+      add(i);
+    }
+  }
+  for (int i = last + 1; i <= lastNonEmptyInst; i++) {
+    if (i != index) {
+      remove(i);
+    }
+  }
+  lastNonEmptyInst = last;
+  if (index <= lastNonEmptyInst) {
+    add(index);
+  }
+}
+
+bool ReferenceIndex::addressReferenced(AddrSpace space, int adr) const {
+  if (space == NONE) {
+    return false;
+  }
+  return !referencedBy.at(space).at(adr).empty();
+}
+
+bool ReferenceIndex::instructionExists(int word) const {
+  return wordCount[word] > 0;
+}
+
+const set<int> &ReferenceIndex::getReferencingInstructions(AddrSpace space,
+                                                           int adr) const {
+  return referencedBy.at(space).at(adr);
+}
+
+int ReferenceIndex::getIndexOfLastNonEmptyInst() const {
+  return lastNonEmptyInst;
+}
+
+///////////////
+/// PRIVATE ///
+///////////////
+
+/*
+ * Instruction references its last first order address (init references
+ * the address it initializes from).
+ */
+void ReferenceIndex::add(int index) {
+  const DecodedInstruction &inst = DECODE_TABLE[words[index]];
+  wordCount[words[index]]++;
+  if (inst.opcode == INIT) {
+    referencedBy[DATA][INIT_OPERAND_INDEX].insert(index);
+  } else if (inst.space != NONE) {
+    referencedBy[inst.space][inst.adr].insert(index);
+  }
+}
+
+void ReferenceIndex::remove(int index) {
+  const DecodedInstruction &inst = DECODE_TABLE[words[index]];
+  wordCount[words[index]]--;
+  if (inst.opcode == INIT) {
+    referencedBy[DATA][INIT_OPERAND_INDEX].erase(index);
+  } else if (inst.space != NONE) {
+    referencedBy[inst.space][inst.adr].erase(index);
+  }
+}
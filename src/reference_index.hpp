@@ -0,0 +1,50 @@
+#ifndef REFERENCE_INDEX_H
+#define REFERENCE_INDEX_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "addr_space.hpp"
+#include "const.hpp"
+
+using namespace std;
+
+class Ram;
+
+/*
+ * Index of the effective instructions (the ones up to the last non-empty
+ * one). It maps addresses to the instructions that reference them, and
+ * instruction words to the number of their occurrences. It gets updated
+ * one changed word at a time, so queries and updates cost the same
+ * regardless of the length of the program.
+ */
+class ReferenceIndex {
+  public:
+    // Last address (IO) can also be referenced, so there is one more
+    // address than words.
+    ReferenceIndex() {
+      referencedBy[CODE] = vector<set<int>>(RAM_SIZE+1);
+      referencedBy[DATA] = vector<set<int>>(RAM_SIZE+1);
+    }
+
+    void update(const Ram &ram);
+    bool addressReferenced(AddrSpace space, int adr) const;
+    bool instructionExists(int word) const;
+    const set<int> &getReferencingInstructions(AddrSpace space,
+                                               int adr) const;
+    int getIndexOfLastNonEmptyInst() const;
+
+  private:
+    // Code words as they were when last indexed.
+    int words[RAM_SIZE] = { };
+    int lastNonEmptyInst = -1;
+    int wordCount[256] = { };
+    map<AddrSpace, vector<set<int>>> referencedBy;
+
+    void setWord(int index, int word);
+    void add(int index);
+    void remove(int index);
+};
+
+#endif
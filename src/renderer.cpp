@@ -1,17 +1,18 @@
 #include "renderer.hpp"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
-#include <iostream>
+#include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
 #include "addr_space.hpp"
-#include "address.hpp"
 #include "const.hpp"
 #include "cpu.hpp"
 #include "cursor.hpp"
-#include "instruction.hpp"
 #include "printer.hpp"
 #include "ram.hpp"
 #include "util.hpp"
@@ -20,255 +21,300 @@
 using namespace std;
 
 /*
- * Only public method. Also static. It creates new object every time 
- * it gets called.
+ * Only public method. Also static. It creates new object every time
+ * it gets called and renders into the passed frame, that is meant to be
+ * kept by the caller between the calls, so its lines only get allocated
+ * once. Only characters at the view's slots and labels get touched, the
+ * rest of the drawing gets copied as is.
  */
-vector<vector<string>> Renderer::renderState(const Printer &printerIn,
-                                             const Ram &ramIn, 
-                                             const Cpu &cpuIn, 
-                                             const Cursor &cursorIn,
-                                             const View &viewIn) {
-  Renderer instance(printerIn, ramIn, cpuIn, cursorIn, viewIn);
-  vector<vector<string>> out;
-  for (vector<string> line : viewIn.lines) {
-    out.push_back(instance.insertActualValues(line));
-  }
-  return out;
-}
-
-vector<string> Renderer::insertActualValues(vector<string> lineIn) {
-  vector<bool> highlightedChars = getHighlightedLocations(lineIn);
-  vector<bool> brightChars = getBrightLocations(lineIn);
-  vector<string> lineOut;
-  int i = 0;
-  for (string cIn : lineIn) {
-    string sOut;
-    bool charIsALightbulb = LIGHTBULB_INDICATORS.count(cIn);
-    if (charIsALightbulb) {
-      bool state = getLightbulb(cIn);
-      if (BRIGHTEN_LIGHTBULBS) {
-        if (state) {
-          brightChars[i] = true;
-        }
-      }
-      sOut = view.getLightbulb(state);
-    } else if (cIn == OUTPUT_INDICATOR) {
-      sOut = getFormattedOutput(switchIndex[cIn]++);
-    } else {
-      sOut = cIn;
+void Renderer::renderState(const Printer &printerIn, const Ram &ramIn,
+                           const Cpu &cpuIn, const Cursor &cursorIn,
+                           const View &viewIn, vector<vector<Cell>> &frame,
+                           bool showHeat) {
+  Renderer instance(printerIn, ramIn, cpuIn, cursorIn, viewIn, frame);
+  instance.resetFrame();
+  instance.markHighlightedLocations();
+  instance.markBrightLocations();
+  instance.insertActualValues();
+  instance.insertHeat(showHeat);
+}
+
+/*
+ * Fills the frame with the drawing. Resize doesn't free the capacity, so
+ * this only allocates the first time, or when the view changes.
+ */
+void Renderer::resetFrame() {
+  const vector<vector<Glyph>> &lines = view.getLines();
+  frame.resize(lines.size());
+  for (size_t y = 0; y < lines.size(); y++) {
+    frame[y].resize(lines[y].size());
+    for (size_t x = 0; x < lines[y].size(); x++) {
+      frame[y][x] = { lines[y][x], 0 };
     }
-    lineOut.push_back(sOut);
-    i++;
-  }
-  return insertEscSeqences(lineOut, highlightedChars, brightChars);
-}
-
-vector<string> Renderer::insertEscSeqences(
-    vector<string> &lineWithoutEscapeSeqences, vector<bool> &highlightedChars,
-    vector<bool> &brightChars) {
-  vector<string> lineOut;
-  bool insideHighlightBlock = false;
-  bool insideBrightBlock = false;
-  for (size_t i = 0; i < lineWithoutEscapeSeqences.size(); i++) {
-    bool firstCharInsideBlock = highlightedChars[i] && !insideHighlightBlock;
-    if (firstCharInsideBlock) {
-      lineOut.insert(lineOut.end(), HIGHLIGHT_ESC_VEC.begin(),   
-                     HIGHLIGHT_ESC_VEC.end());
-      insideHighlightBlock = true;
+  }
+}
+
+/*
+ * Glyphs of the lightbulb indicators only get looked up on the first call.
+ */
+void Renderer::insertActualValues() {
+  struct Lightbulbs {
+    Glyph indicator;
+    BitGetter getBit;
+  };
+  static const Lightbulbs lightbulbs[] = {
+    { GlyphTable::getGlyph(CODE_INDICATOR), &Renderer::getCodeBit },
+    { GlyphTable::getGlyph(DATA_INDICATOR), &Renderer::getDataBit },
+    { GlyphTable::getGlyph(REGISTER_INDICATOR), &Renderer::getRegisterBit },
+    { GlyphTable::getGlyph(CODE_ADR_INDICATOR),
+      &Renderer::getCodeAdrIndicator },
+    { GlyphTable::getGlyph(DATA_ADR_INDICATOR),
+      &Renderer::getDataAdrIndicator }
+  };
+  for (const Lightbulbs &bulbs : lightbulbs) {
+    insertLightbulbs(bulbs.indicator, bulbs.getBit);
+  }
+  const vector<Position> &slots = view.getSlots(OUTPUT_INDICATOR);
+  for (size_t i = 0; i < slots.size(); i++) {
+    frame[slots[i].y][slots[i].x].glyph = getFormattedOutput(i);
+  }
+}
+
+/*
+ * Sets or toggles the attribute of the character at the location.
+ */
+void Renderer::mark(uint8_t attr, Position pos, bool toggle) {
+  bool outOfFrame = (size_t) pos.y >= frame.size() ||
+                    (size_t) pos.x >= frame[pos.y].size();
+  if (outOfFrame) {
+    return;
+  }
+  uint8_t &attrs = frame[pos.y][pos.x].attrs;
+  attrs = toggle ? attrs ^ attr : attrs | attr;
+}
+
+///////////////
+/// HEATMAP ///
+///////////////
+
+/*
+ * Colors the code and data lightbulbs by how many times the instruction got
+ * executed or the word got accessed, relative to the busiest address, and
+ * fills the counters (if drawing has them). Counters are left blank if
+ * heatmap is not shown.
+ */
+void Renderer::insertHeat(bool showHeat) {
+  size_t maxHeat = 0;
+  if (showHeat) {
+    for (AddrSpace space : { CODE, DATA }) {
+      const vector<size_t> &heat = cpu.getHeat(space);
+      maxHeat = max(maxHeat, *max_element(heat.begin(), heat.end()));
     }
-    bool firstCharOutsideBlock = !highlightedChars[i] && insideHighlightBlock;
-    if (firstCharOutsideBlock) {
-      lineOut.insert(lineOut.end(), HIGHLIGHT_END_ESC_VEC.begin(), 
-                     HIGHLIGHT_END_ESC_VEC.end());
-      insideHighlightBlock = false;
+  }
+  if (maxHeat > 0) {
+    for (AddrSpace space : { CODE, DATA }) {
+      const string &indicator = space == CODE ? CODE_INDICATOR : DATA_INDICATOR;
+      const vector<Position> &slots = view.getSlots(indicator);
+      for (size_t i = 0; i < slots.size(); i++) {
+        mark(getHeatLevel(space, i / WORD_SIZE, maxHeat), slots[i]);
+      }
     }
-    firstCharInsideBlock = brightChars[i] && !insideBrightBlock;
-    if (firstCharInsideBlock) {
-      lineOut.insert(lineOut.end(), BRIGHT_ESC_VEC.begin(),   
-                     BRIGHT_ESC_VEC.end());
-      insideBrightBlock = true;
+  }
+  insertHeatCounters(CODE_HEAT_INDICATOR, CODE, showHeat, maxHeat);
+  insertHeatCounters(DATA_HEAT_INDICATOR, DATA, showHeat, maxHeat);
+}
+
+/*
+ * Returns heat attribute of the address, level 0 if it wasn't accessed,
+ * and 3 if it was accessed the most.
+ */
+uint8_t Renderer::getHeatLevel(AddrSpace space, int adr, size_t maxHeat) {
+  const vector<size_t> &heat = cpu.getHeat(space);
+  if (maxHeat == 0 || (size_t) adr >= heat.size() || heat[adr] == 0) {
+    return 0;
+  }
+  size_t level = 1 + 2 * heat[adr] / maxHeat;
+  return (uint8_t) (level << HEAT_SHIFT);
+}
+
+/*
+ * Each address gets the same number of counter characters.
+ */
+void Renderer::insertHeatCounters(const string &indicator, AddrSpace space,
+                                  bool showHeat, size_t maxHeat) {
+  const vector<Position> &slots = view.getSlots(indicator);
+  size_t width = slots.size() / RAM_SIZE;
+  if (width == 0) {
+    return;
+  }
+  const vector<size_t> &heat = cpu.getHeat(space);
+  char count[MAX_COUNT_WIDTH];
+  for (int adr = 0; adr < RAM_SIZE; adr++) {
+    memset(count, ' ', sizeof(count));
+    if (showHeat) {
+      formatCount(heat[adr], count, min(width, sizeof(count)));
     }
-    firstCharOutsideBlock = !brightChars[i] && insideBrightBlock;
-    if (firstCharOutsideBlock) {
-      lineOut.insert(lineOut.end(), BRIGHT_END_ESC_VEC.begin(), 
-                     BRIGHT_END_ESC_VEC.end());
-      insideBrightBlock = false;
+    for (size_t i = 0; i < width; i++) {
+      Position pos = slots[adr * width + i];
+      char c = i < sizeof(count) ? count[i] : ' ';
+      frame[pos.y][pos.x].glyph = GlyphTable::getGlyph(c);
+      mark(getHeatLevel(space, adr, maxHeat), pos);
     }
-    lineOut.push_back(lineWithoutEscapeSeqences[i]);
   }
-  return lineOut;
 }
 
-////////////////////////////
-/// GET BRIGHT LOCATIONS ///
-////////////////////////////
+/*
+ * Writes right aligned count to the first 'width' characters of 'out'. It
+ * gets shortened with a k, M or G suffix if it doesn't fit the width. Zero
+ * is left blank.
+ */
+void Renderer::formatCount(size_t count, char *out, size_t width) {
+  memset(out, ' ', width);
+  if (count == 0) {
+    return;
+  }
+  char digits[MAX_COUNT_WIDTH];
+  size_t length = snprintf(digits, sizeof(digits), "%zu", count);
+  for (const char *suffix = "kMG"; length > width && *suffix; suffix++) {
+    count /= 1000;
+    length = snprintf(digits, sizeof(digits), "%zu%c", count, *suffix);
+  }
+  size_t shown = min(width, length);
+  memcpy(out + width - shown, digits, shown);
+}
+
+/////////////////////////////
+/// MARK BRIGHT LOCATIONS ///
+/////////////////////////////
 
-vector<bool> Renderer::getBrightLocations(vector<string> &lineIn) {
-  vector<bool> brightLocations (lineIn.size(), false);
+void Renderer::markBrightLocations() {
   if (BRIGHTEN_CURSOR) {
-    highlightCursor(brightLocations, lineIn);
+    highlightCursor(BRIGHT);
   }
-  return brightLocations;
 }
 
-/////////////////////////////////
-/// GET HIGHLIGHTED LOCATIONS ///
-/////////////////////////////////
+//////////////////////////////////
+/// MARK HIGHLIGHTED LOCATIONS ///
+//////////////////////////////////
 
-vector<bool> Renderer::getHighlightedLocations(vector<string> &lineIn) {
-  vector<bool> highlightedLocations (lineIn.size(), false);
-  highlightPc(highlightedLocations, lineIn);
+void Renderer::markHighlightedLocations() {
+  highlightPc();
   if (executionEnded()) {
-    return highlightedLocations;
+    return;
   }
-  highlightCursor(highlightedLocations, lineIn);
-  Instruction *inst = getInstruction();
-  bool cursorOnData = inst == NULL;
+  highlightCursor(HIGHLIGHTED);
+  bool cursorOnData = getInstruction() == NULL;
   if (cursorOnData) {
-    highlightPointingInstructions(highlightedLocations, lineIn);
-    return highlightedLocations;
+    highlightPointingInstructions();
+    return;
   }
-  highlightOperator(highlightedLocations, lineIn, inst);
-  if (inst->adr.space == CODE) {
-    highlightCodeWord(highlightedLocations, lineIn, inst);
-  } else if (inst->adr.space == DATA) {
-    highlightDataWord(highlightedLocations, lineIn, inst);
+  highlightOperator();
+  if (instructionSpace == CODE) {
+    highlightCodeWord();
+  } else if (instructionSpace == DATA) {
+    highlightDataWord();
   }
-  return highlightedLocations;
 }
 
-void Renderer::highlightPc(vector<bool> &highlightedLocations,
-                                   vector<string> &lineIn) {
-  if (executionHasntStarted() || pcHighlighted) {
+void Renderer::highlightPc() {
+  if (executionHasntStarted()) {
     return;
   }
-  for (size_t i = 0; i < lineIn.size(); i++) {
-    if (lineIn[i] == CODE_ADR_INDICATOR) {
-      int index = switchIndex[CODE_ADR_INDICATOR];
-      if (pcPointingToAddress(index)) {
-        highlightedLocations[i] = true;
-        pcHighlighted = true;
-        return;
-      }
-    }
+  const vector<Position> &slots = view.getSlots(CODE_ADR_INDICATOR);
+  size_t pc = Util::getInt(cpu.getPc());
+  if (pc < slots.size()) {
+    mark(HIGHLIGHTED, slots[pc]);
   }
 }
 
-void Renderer::highlightCursor(vector<bool> &highlightedLocations,
-                               vector<string> &lineIn) {
+void Renderer::highlightCursor(uint8_t attr) {
   if (!executionHasntStarted()) {
     return;
   }
   if (cursor.getAddressSpace() == CODE) {
-    findCursor(highlightedLocations, lineIn, CODE_INDICATOR);
+    findCursor(attr, CODE_INDICATOR);
   } else if (cursor.getAddressSpace() == DATA) {
-    findCursor(highlightedLocations, lineIn, DATA_INDICATOR);
+    findCursor(attr, DATA_INDICATOR);
   }
 }
 
-void Renderer::findCursor(vector<bool> &highlightedLocations,
-                                  vector<string> &lineIn, string c) {
-  int indexDelta = 0;
-  for (size_t i = 0; i < lineIn.size(); i++) {
-    if (lineIn[i] == c) {
-      int lightbulbIndex = switchIndex[c] + indexDelta++;
-      if (cursor.getAbsoluteBitIndex() == lightbulbIndex) {
-        highlightedLocations[i] = true;
-        return;
-      }
-    }
+void Renderer::findCursor(uint8_t attr, const string &c) {
+  const vector<Position> &slots = view.getSlots(c);
+  size_t lightbulbIndex = cursor.getAbsoluteBitIndex();
+  if (lightbulbIndex < slots.size()) {
+    mark(attr, slots[lightbulbIndex]);
   }
 }
 
-void Renderer::highlightPointingInstructions(vector<bool> &highlightedLocations,
-                                             vector<string> &lineIn) {
-  set<int> *pointingInstructions = getIndexesOfPointingInstructions();
-  for (size_t i = 0; i < lineIn.size(); i++) {
-    if (lineIn[i] == CODE_INDICATOR) {
-      int addressValue = switchIndex[CODE_INDICATOR] / WORD_SIZE;
-      if (pointingInstructions->count(addressValue)) {
-        highlightedLocations[i] = true;
-      }
+void Renderer::highlightPointingInstructions() {
+  const vector<Position> &slots = view.getSlots(CODE_INDICATOR);
+  for (size_t i = 0; i < slots.size(); i++) {
+    int addressValue = i / WORD_SIZE;
+    if (isInstructionPointingToCursor(addressValue)) {
+      mark(HIGHLIGHTED, slots[i]);
     }
   }
 }
 
-void Renderer::highlightOperator(vector<bool> &highlightedLocations,
-                                         vector<string> &lineIn,
-                                         Instruction *inst) {
+void Renderer::highlightOperator() {
+  int index = instructionWord >> 4;
+  int logicIndex = instructionWord & 0x0f;
   string exclude;
-  if (inst->isLogic()) {
-    exclude = LOGIC_OPS_INDICATOR[min(inst->logicIndex, 8)];
+  if (index == LOGIC_OPS_INDEX) {
+    exclude = LOGIC_OPS_INDICATOR[min(logicIndex, 8)];
   }
-  if (inst->index == INC_DEC_OPS_INDEX) {
-    if (inst->logicIndex <= 7) {
+  if (index == INC_DEC_OPS_INDEX) {
+    if (logicIndex <= 7) {
       exclude = "INC";
     } else {
       exclude = "DEC";
     }
   }
-  string label = " " + inst->label;
-  label.append(11 - inst->label.length(), ' ');  
-  highlightLabel(highlightedLocations, lineIn, Util::stringToVecOfString(label), 
-                 Util::stringToVecOfString(exclude));
+  highlightLabel(View::getOperatorLabel(instruction->label), exclude);
 }
 
-void Renderer::highlightCodeWord(vector<bool> &highlightedLocations,
-                                        vector<string> &lineIn,
-                                        Instruction *inst) {
-  if (inst->adr.val == LAST_ADDRESS) {
-    vector<string> stopLabel = Util::stringToVecOfString(LAST_CODE_ADDR_LABEL);
-    highlightLabel(highlightedLocations, lineIn, stopLabel, {});
+void Renderer::highlightCodeWord() {
+  if (instructionAdr == RAM_SIZE) {
+    highlightLabel(LAST_CODE_ADDR_LABEL, "");
     return;
   }
-  highlightWord(highlightedLocations, lineIn, CODE_INDICATOR, CODE);
+  highlightWord(CODE_INDICATOR, CODE);
 }
 
-void Renderer::highlightDataWord(vector<bool> &highlightedLocations,
-                                         vector<string> &lineIn,
-                                         Instruction *inst) {
-  if (inst->adr.val == LAST_ADDRESS) {
-    vector<string> inOutLabel = Util::stringToVecOfString(LAST_DATA_ADDR_LABEL);
-    highlightLabel(highlightedLocations, lineIn, inOutLabel, {});
+void Renderer::highlightDataWord() {
+  if (instructionAdr == RAM_SIZE) {
+    highlightLabel(LAST_DATA_ADDR_LABEL, "");
     return;
   }
-  highlightWord(highlightedLocations, lineIn, DATA_INDICATOR, DATA);
+  highlightWord(DATA_INDICATOR, DATA);
 }
 
-void Renderer::highlightWord(vector<bool> &highlightedLocations,
-                                     vector<string> &lineIn, string indicator,
-                                     AddrSpace addrSpace) {
-  for (size_t i = 0; i < lineIn.size(); i++) {
-    if (lineIn[i] == indicator) {
-      int addressValue = switchIndex[indicator] / WORD_SIZE;
-      Address adr = Address(addrSpace, Util::getBoolNibb(addressValue));
-      if (instructionPointingToAddress(adr)) {
-        highlightedLocations[i] = !highlightedLocations[i];
-      }
+void Renderer::highlightWord(const string &indicator, AddrSpace addrSpace) {
+  const vector<Position> &slots = view.getSlots(indicator);
+  for (size_t i = 0; i < slots.size(); i++) {
+    int addressValue = i / WORD_SIZE;
+    if (instructionPointingToAddress(addrSpace, addressValue)) {
+      mark(HIGHLIGHTED, slots[i], true);
     }
   }
 }
 
-void Renderer::highlightLabel(vector<bool> &highlightedLocations,
-                                     vector<string> &lineIn,
-                                     vector<string> label,
-                                     vector<string> exclude) {
-  auto it = search(begin(lineIn), end(lineIn), begin(label), end(label));
-  int labelPosition = it - lineIn.begin();
-  bool notFound = it == end(lineIn);
-  if (notFound) {
-    return;
-  }
+/*
+ * Highlights all characters of the label, except for the ones that are
+ * part of 'exclude'.
+ */
+void Renderer::highlightLabel(const string &label, const string &exclude) {
   size_t excludePosition = numeric_limits<size_t>::max();
   if (!exclude.empty()) {
-    it = search(begin(label), end(label), begin(exclude), end(exclude));
-    excludePosition = it - label.begin();
-  }
-  for (size_t i = labelPosition; i < labelPosition + label.size(); i++) {
-    bool highlight = (i < labelPosition + excludePosition ||
-                      i >= labelPosition + excludePosition + exclude.size());
-    if (highlight) {
-      highlightedLocations[i] = true;
+    excludePosition = min(label.find(exclude), label.size());
+  }
+  for (Position pos : view.getLabelPositions(label)) {
+    for (size_t i = 0; i < label.size(); i++) {
+      bool highlight = (i < excludePosition ||
+                        i >= excludePosition + exclude.size());
+      if (highlight) {
+        mark(HIGHLIGHTED, { pos.y, pos.x + (int) i });
+      }
     }
   }
 }
@@ -277,23 +323,21 @@ void Renderer::highlightLabel(vector<bool> &highlightedLocations,
 /// GET LIGHTBULB ///
 /////////////////////
 
-bool Renderer::getLightbulb(string cIn) {
-  int i = switchIndex[cIn]++;
-  if (cIn == CODE_INDICATOR) {
-    return getCodeBit(i);
-  } else if (cIn == DATA_INDICATOR) {
-    return getDataBit(i);
-  } else if (cIn == REGISTER_INDICATOR) {
-    return cpu.getRegister().at(i);
-  } else if (cIn == CODE_ADR_INDICATOR) {
-    return getAdrIndicator(CODE, i);
-  } else if (cIn == DATA_ADR_INDICATOR) {
-    bool val = getAdrIndicator(DATA, i);
-    return val;
-  }
-  cerr << "There was an error parsing a drawing file.";
-  cerr << " Problem with char" << cIn << ". Will ignore it.";
-  return false;
+/*
+ * Sets the lightbulbs at the indicator's slots to the values that the
+ * getter returns for their indexes.
+ */
+void Renderer::insertLightbulbs(Glyph indicator, BitGetter getBit) {
+  const vector<Position> &slots = view.getSlots(indicator);
+  for (size_t i = 0; i < slots.size(); i++) {
+    bool state = (this->*getBit)(i);
+    if (BRIGHTEN_LIGHTBULBS) {
+      if (state) {
+        mark(BRIGHT, slots[i]);
+      }
+    }
+    frame[slots[i].y][slots[i].x].glyph = view.getLightbulb(state);
+  }
 }
 
 bool Renderer::getCodeBit(int i) {
@@ -304,6 +348,18 @@ bool Renderer::getDataBit(int i) {
   return getBit(DATA, i);
 }
 
+bool Renderer::getRegisterBit(int i) {
+  return cpu.getRegister().at(i);
+}
+
+bool Renderer::getCodeAdrIndicator(int i) {
+  return getAdrIndicator(CODE, i);
+}
+
+bool Renderer::getDataAdrIndicator(int i) {
+  return getAdrIndicator(DATA, i);
+}
+
 bool Renderer::getBit(AddrSpace space, int i) {
   pair<int, int> coord = convertIndexToCoordinates(i);
   return ram.state.at(space).at(coord.second).at(coord.first);
@@ -315,44 +371,32 @@ pair<int, int> Renderer::convertIndexToCoordinates(int index) {
   return pair<int, int>(x, y);
 }
 
-bool Renderer::pcPointingToAddress(int adr) {
-  if (executionHasntStarted()) {
-    return false;
-  }
-  return Util::getInt(cpu.getPc()) == adr;
-}
-
 bool Renderer::getAdrIndicator(AddrSpace addrSpace, int index) {
-  Address indicatorsAddress = Address(addrSpace, Util::getBoolNibb(index));
-  return isAddressReferencedFirstOrder(indicatorsAddress);
+  return isAddressReferencedFirstOrder(addrSpace, index);
 }
 
 //////////////////
 /// GET OUTPUT ///
 //////////////////
 
-string Renderer::getFormattedOutput(int i) {
-  if (printer.getPrinterOutput().length() <= (unsigned) i) {
-    return " ";
-  } else {
-    return string(1, printer.getPrinterOutput().at(i));
-  }
+Glyph Renderer::getFormattedOutput(int i) {
+  return GlyphTable::getGlyph(printer.getPaperChar(i));
 }
 
 ///////////////////////
 /// GET INSTRUCTION ///
 ///////////////////////
 
-Instruction* Renderer::getInstruction() {
+const DecodedInstruction *Renderer::getInstruction() {
   bool noActiveInstruction = !machineActive() &&
                              cursor.getAddressSpace() == DATA;
   if (noActiveInstruction) {
     return NULL;
   }
-  if (instruction.size() == 0) {
-    instruction.push_back(initializeInstruction());
+  if (!instructionDecoded) {
+    decodeInstruction();
   }
-  return &instruction[0];
+  return instruction;
 }
 
 bool Renderer::machineActive() {
@@ -367,83 +411,134 @@ bool Renderer::executionEnded() {
   return Util::getInt(cpu.getPc()) == RAM_SIZE;
 }
 
-Instruction Renderer::initializeInstruction() {
+/*
+ * While machine is idle the instruction under the cursor gets decoded as if
+ * the register was empty.
+ */
+void Renderer::decodeInstruction() {
+  const vector<vector<bool>> &code = ram.state.at(CODE);
+  int reg = 0;
   if (machineActive()) {
-    return cpu.getInstruction();
+    instructionWord = Util::getInt(code[Util::getInt(cpu.getPc())]);
+    reg = Util::getInt(cpu.getRegister());
   } else {
-    return Instruction(cursor.getWord(), EMPTY_WORD, &ram);
+    instructionWord = Util::getInt(code[cursor.getY()]);
   }
-}
-
-bool Renderer::instructionHasId(int id) {
-  Instruction *inst = getInstruction();
-  if (inst == NULL) {
-    return false;
-  }
-  return inst->index == id;
+  instruction = &DECODE_TABLE[instructionWord];
+  getAccessedAddress(*instruction, reg, instructionSpace, instructionAdr);
+  instructionDecoded = true;
 }
 
 /*
  * Is instruction pointing to passed address in passed address space.
  */
-bool Renderer::instructionPointingToAddress(Address adr) {
-  Instruction *inst = getInstruction();
-  if (inst == NULL) {
+bool Renderer::instructionPointingToAddress(AddrSpace space, int adr) {
+  if (getInstruction() == NULL) {
     return false;
   }
-  return inst->adr == adr;
+  return instructionSpace == space && instructionAdr == adr;
 }
 
 /// INSTRUCTION HIGHLIGHT ///
 
-set<int>* Renderer::getIndexesOfPointingInstructions() {
-  if (pointingInstructions.empty()) {
-    pointingInstructions = generatePointingInstructions();
-    if (pointingInstructions.empty()) {
-      pointingInstructions.insert(-1);
-    }
+bool Renderer::isInstructionPointingToCursor(int index) {
+  if (index < 0 || index >= RAM_SIZE) {
+    return false;
   }
-  return &pointingInstructions;
+  indexEffectiveInstructions();
+  return pointingInstructions[index];
 }
 
-set<int> Renderer::generatePointingInstructions() {
-  vector<Instruction> *instructions = getEffectiveInstructions();
-  set<int> out;
-  int i = 0;
-  for (Instruction inst : *instructions) {
-    if (inst.adr == cursor.getAddress()) {
-      out.insert(i);
-    }
-    i++;
+/// ADDRESS INDICATOR ///
+
+bool Renderer::isAddressReferencedFirstOrder(AddrSpace space, int adr) {
+  if (space == NONE || adr < 0 || adr >= (1 << ADDR_SIZE)) {
+    return false;
   }
-  return out;
+  indexEffectiveInstructions();
+  return referencedAddresses[space][adr];
 }
 
-/// ADDRESS INDICATOR ///
+/// UTIL ///
 
-bool Renderer::isAddressReferencedFirstOrder(Address adr) {
-  vector<Instruction> *instructions = getEffectiveInstructions();
-  for (Instruction inst : *instructions) {
-    vector<Address> aaa = inst.firstOrderAdr;
-    bool isReferenced = find(aaa.begin(), aaa.end(), adr) != aaa.end();
-    if (isReferenced) {
-      return true;
+/*
+ * Traverses the effective instructions (the ones up to the last non-empty
+ * one) only once per frame instead of once per indicator. They get decoded
+ * with the table, straight from the code words.
+ */
+void Renderer::indexEffectiveInstructions() {
+  if (effectiveInstructionsIndexed) {
+    return;
+  }
+  memset(pointingInstructions, 0, sizeof(pointingInstructions));
+  memset(referencedAddresses, 0, sizeof(referencedAddresses));
+  const vector<vector<bool>> &code = ram.state.at(CODE);
+  int lastNonEmptyInst = RAM_SIZE - 1;
+  while (lastNonEmptyInst >= 0 &&
+         Util::getInt(code[lastNonEmptyInst]) == 0) {
+    lastNonEmptyInst--;
+  }
+  AddrSpace cursorSpace = cursor.getAddressSpace();
+  int cursorAdr = cursor.getY();
+  for (int i = 0; i <= lastNonEmptyInst; i++) {
+    const DecodedInstruction &inst = DECODE_TABLE[Util::getInt(code[i])];
+    if (inst.space != NONE) {
+      referencedAddresses[inst.space][inst.adr] = true;
+    }
+    if (inst.opcode == INIT) {
+      referencedAddresses[DATA][INIT_OPERAND_INDEX] = true;
     }
+    pointingInstructions[i] = instructionAccessesAddress(inst, cursorSpace,
+                                                         cursorAdr);
   }
-  return false;
+  effectiveInstructionsIndexed = true;
 }
 
-/// UTIL ///
+/*
+ * Register is assumed to be empty.
+ */
+bool Renderer::instructionAccessesAddress(const DecodedInstruction &inst,
+                                          AddrSpace space, int adr) {
+  AddrSpace accessedSpace;
+  int accessedAdr;
+  getAccessedAddress(inst, 0, accessedSpace, accessedAdr);
+  return space == accessedSpace && adr == accessedAdr;
+}
+
+/*
+ * Address that instruction accesses, with pointers read from the ram. If
+ * it is unknown, space is set to NONE.
+ */
+void Renderer::getAccessedAddress(const DecodedInstruction &inst, int reg,
+                                  AddrSpace &space, int &adr) {
+  switch (inst.opcode) {
+    case JUMP_REG:
+      space = CODE;
+      adr = reg & 0x0f;
+      return;
+    case READ_REG:
+      space = DATA;
+      adr = reg & 0x0f;
+      return;
+    case READ_POINTER:
+    case WRITE_POINTER:
+      adr = getPointer(inst.adr);
+      space = adr < 0 ? NONE : DATA;
+      return;
+    default:
+      space = inst.space;
+      adr = inst.adr;
+  }
+}
 
 /*
- * Doesn't include empty instructions from last non-empty forward.
+ * Pointer at the last address would have to be read from the input, so it
+ * is unknown, and -1 gets returned.
  */
-vector<Instruction>* Renderer::getEffectiveInstructions() {
-  if (!effectiveInstructionsInitialized) {
-    effectiveInstructions =
-        Instruction::getEffectiveInstructions(ram, cpu.getRegister());
-    effectiveInstructionsInitialized = true;
+int Renderer::getPointer(int adr) {
+  if (adr >= RAM_SIZE) {
+    return -1;
   }
-  return &effectiveInstructions;
+  return Util::getInt(ram.state.at(DATA)[adr]) & 0x0f;
 }
 
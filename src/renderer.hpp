@@ -2,31 +2,28 @@
 #define RENDERER_H
 
 #include <map>
-#include <set>
 #include <string>
 #include <vector>
 
 #include "addr_space.hpp"
 #include "const.hpp"
+#include "decode_table.hpp"
+#include "glyph.hpp"
+#include "view.hpp"
 
 using namespace std;
 
-class Address;
 class Cpu;
 class Cursor;
-class Instruction;
 class Printer;
 class Ram;
-class SpecificInstruction;
-class View;
 
 class Renderer {
   public:
-    static vector<vector<string>> renderState(const Printer &printerIn,
-                                              const Ram &ramIn, 
-                                              const Cpu &cpuIn, 
-                                              const Cursor &cursorIn, 
-                                              const View &view);
+    static void renderState(const Printer &printerIn, const Ram &ramIn,
+                            const Cpu &cpuIn, const Cursor &cursorIn,
+                            const View &view, vector<vector<Cell>> &frame,
+                            bool showHeat);
 
   private:
     const Printer &printer;
@@ -34,79 +31,88 @@ class Renderer {
     const Cpu &cpu;
     const Cursor &cursor;
     const View &view;
+    vector<vector<Cell>> &frame;
     Renderer (const Printer &printerIn, const Ram &ramIn, const Cpu &cpuIn,
-              const Cursor &cursorIn, const View &viewIn)
+              const Cursor &cursorIn, const View &viewIn,
+              vector<vector<Cell>> &frameIn)
         : printer(printerIn),
           ram(ramIn),
           cpu(cpuIn),
           cursor(cursorIn),
-          view(viewIn) { }
-    // Just a way to leave instruction uninitialized at Renderers creation, and
-    // optionaly create it later (intended to hold only zero or one 
-    // instruction).
-    vector<Instruction> instruction;
-    // vector<Instruction> allInstructions;
-    set<int> pointingInstructions;
-    bool effectiveInstructionsInitialized = false;
-    vector<Instruction> effectiveInstructions;
-    // Counts occurances of a char in a drawing.
-    map<string, int> switchIndex;
+          view(viewIn),
+          frame(frameIn) { }
+    // Instruction under the pc, or under the cursor while machine is idle.
+    // It gets decoded with the table on first use, together with the address
+    // it accesses (space is NONE if it doesn't access any, or if the address
+    // is unknown).
+    bool instructionDecoded = false;
+    int instructionWord = 0;
+    const DecodedInstruction *instruction = NULL;
+    AddrSpace instructionSpace = NONE;
+    int instructionAdr = 0;
+    // Effective instructions get indexed from their words with the decode
+    // table, once per frame, on first use. Whether instruction at the index
+    // accesses the address under the cursor, and whether address is
+    // referenced by any of them, by address space and address.
+    bool effectiveInstructionsIndexed = false;
+    bool pointingInstructions[RAM_SIZE];
+    bool referencedAddresses[NONE][1 << ADDR_SIZE];
 
     // RENDER STATE
-    vector<string> insertActualValues(vector<string> lineIn);
-    vector<string> insertEscSeqences(vector<string> &lineWithoutEscapeSeqences,
-                                     vector<bool> &highlightedChars,
-                                     vector<bool> &brightChars);
+    void resetFrame();
+    void insertActualValues();
+    void mark(uint8_t attr, Position pos, bool toggle = false);
 
-    // GET HIGHLIGHTED LOCATIONS
-    bool pcHighlighted = false;
-    vector<bool> getHighlightedLocations(vector<string> &lineIn);
-    vector<bool> getBrightLocations(vector<string> &lineIn);
-    void highlightPc(vector<bool> &highlightedLocations,
-                     vector<string> &lineIn);
-    void highlightCursor(vector<bool> &highlightedLocations,
-                         vector<string> &lineIn);
-    void findCursor(vector<bool> &highlightedLocations, vector<string> &lineIn,
-                    string c);
-    void highlightPointingInstructions(vector<bool> &highlightedLocations,
-                                       vector<string> &lineIn);
-    void highlightOperator(vector<bool> &highlightedLocations,
-                           vector<string> &lineIn, Instruction *inst);
-    void highlightCodeWord(vector<bool> &highlightedLocations,
-                           vector<string> &lineIn, Instruction *inst);
-    void highlightDataWord(vector<bool> &highlightedLocations,
-                           vector<string> &lineIn, Instruction *inst);
-    void highlightWord(vector<bool> &highlightedLocations,
-                       vector<string> &lineIn, string indicator,
-                       AddrSpace addrSpace);
-    void highlightLabel(vector<bool> &highlightedLocations, 
-                        vector<string> &lineIn, vector<string> label, 
-                        vector<string> exclude);
+    // HEATMAP
+    void insertHeat(bool showHeat);
+    uint8_t getHeatLevel(AddrSpace space, int adr, size_t maxHeat);
+    void insertHeatCounters(const string &indicator, AddrSpace space,
+                            bool showHeat, size_t maxHeat);
+    static void formatCount(size_t count, char *out, size_t width);
+
+    // MARK HIGHLIGHTED LOCATIONS
+    void markHighlightedLocations();
+    void markBrightLocations();
+    void highlightPc();
+    void highlightCursor(uint8_t attr);
+    void findCursor(uint8_t attr, const string &c);
+    void highlightPointingInstructions();
+    void highlightOperator();
+    void highlightCodeWord();
+    void highlightDataWord();
+    void highlightWord(const string &indicator, AddrSpace addrSpace);
+    void highlightLabel(const string &label, const string &exclude);
 
     // GET LIGHTBULB
-    bool getLightbulb(string cIn);
+    typedef bool (Renderer::*BitGetter)(int i);
+    void insertLightbulbs(Glyph indicator, BitGetter getBit);
     bool getCodeBit(int i);
     bool getDataBit(int i);
+    bool getRegisterBit(int i);
+    bool getCodeAdrIndicator(int i);
+    bool getDataAdrIndicator(int i);
     bool getBit(AddrSpace space, int i);
     static pair<int, int> convertIndexToCoordinates(int index);
-    bool pcPointingToAddress(int adr);
     bool getAdrIndicator(AddrSpace addrSpace, int index);
 
     // GET OUTPUT
-    string getFormattedOutput(int i);
+    Glyph getFormattedOutput(int i);
     
     // GET INSTRUCTION
-    Instruction* getInstruction();
+    const DecodedInstruction *getInstruction();
     bool machineActive();
     bool executionHasntStarted();
     bool executionEnded();
-    Instruction initializeInstruction();
-    bool instructionHasId(int id);
-    bool instructionPointingToAddress(Address adr);
-    set<int>* getIndexesOfPointingInstructions();
-    set<int> generatePointingInstructions();
-    vector<Instruction>* getEffectiveInstructions();
-    bool isAddressReferencedFirstOrder(Address adr);
+    void decodeInstruction();
+    bool instructionPointingToAddress(AddrSpace space, int adr);
+    bool isInstructionPointingToCursor(int index);
+    bool isAddressReferencedFirstOrder(AddrSpace space, int adr);
+    void indexEffectiveInstructions();
+    bool instructionAccessesAddress(const DecodedInstruction &inst,
+                                    AddrSpace space, int adr);
+    void getAccessedAddress(const DecodedInstruction &inst, int reg,
+                            AddrSpace &space, int &adr);
+    int getPointer(int adr);
 };
 
 #endif
\ No newline at end of file
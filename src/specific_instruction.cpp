@@ -11,9 +11,7 @@
 using namespace std;
 
 // UTIL FUNCTIONS
-static string getLogicOpsIndicator();
 static void increasePc(vector<bool> &pc);
-static Address getThreeBitAddress(const vector<bool> &val);
 static void addOrSubtract(const Address &adr, vector<bool> &reg, Ram &ram, bool add);
 static void shift(vector<bool> &pc, vector<bool> &reg, int delta);
 static bool getRegBit(vector<bool> &reg, int index);
@@ -33,23 +31,11 @@ void Read::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ra
   increasePc(pc);
 }
 
-vector<Address> Read::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address Read::getAddress(Address &firstOrderAdr, const vector<bool> &reg, 
                         const Ram *ram) {
   return firstOrderAdr;
 }
 
-string Read::getLabel() {
-  return "READ  ";
-}
-
-int Read::getAdrIndex() {
-  return 4;
-}
-
 string Read::getCode(const Address &adr, int pc) {
   return "reg = "+getOperand(adr)+";";
 }
@@ -64,23 +50,11 @@ void Write::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &r
   increasePc(pc);
 }
 
-vector<Address> Write::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address Write::getAddress(Address &firstOrderAdr, const vector<bool> &reg, 
                           const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Write::getLabel() {
-  return "WRITE  ";
-}
-
-int Write::getAdrIndex() {
-  return 4;
-}
-
 string Write::getCode(const Address &adr, int pc) {
   if (adr.val == LAST_ADDRESS) {
     return "pc = "+to_string(pc)+"; return reg;";
@@ -100,23 +74,11 @@ void Add::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram
   increasePc(pc);
 }
 
-vector<Address> Add::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address Add::getAddress(Address &firstOrderAdr, const vector<bool> &reg, 
                         const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Add::getLabel() {
-  return "ADD";
-}
-
-int Add::getAdrIndex() {
-  return 4;
-}
-
 string Add::getCode(const Address &adr, int pc) {
   return "reg = sadd(reg, "+getOperand(adr)+");";
 }
@@ -133,23 +95,11 @@ void Sub::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram
   increasePc(pc);
 }
 
-vector<Address> Sub::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address Sub::getAddress(Address &firstOrderAdr, const vector<bool> &reg, 
                         const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Sub::getLabel() {
-  return "SUB";
-}
-
-int Sub::getAdrIndex() {
-  return 4;
-}
-
 string Sub::getCode(const Address &adr, int pc) {
   return "reg = ssub(reg, "+getOperand(adr)+");";
 }
@@ -163,23 +113,11 @@ void Jump::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ra
   pc = adr.val;
 }
 
-vector<Address> Jump::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(CODE, Util::getSecondNibble(val)) };
-}
-
 Address Jump::getAddress(Address &firstOrderAdr, const vector<bool> &reg, 
                          const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Jump::getLabel() {
-  return "JUMP";
-}
-
-int Jump::getAdrIndex() {
-  return 4;
-}
-
 string Jump::getCode(const Address &adr, int pc) {
   return "goto *a["+adr.getIntStr()+"];";
 }
@@ -197,23 +135,11 @@ void IfMax::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &r
   }
 }
 
-vector<Address> IfMax::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(CODE, Util::getSecondNibble(val)) };
-}
-
 Address IfMax::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                           const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string IfMax::getLabel() {
-  return "IF MAX";
-}
-
-int IfMax::getAdrIndex() {
-  return 4;
-}
-
 string IfMax::getCode(const Address &adr, int pc) {
   return "if (reg == "+to_string(MAX_VALUE)+") goto *a["+adr.getIntStr()+"];";
 }
@@ -231,23 +157,11 @@ void IfMin::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &r
   }
 }
 
-vector<Address> IfMin::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(CODE, Util::getSecondNibble(val)) };
-}
-
 Address IfMin::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                           const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string IfMin::getLabel() {
-  return "IF MIN";
-}
-
-int IfMin::getAdrIndex() {
-  return 4;
-}
-
 string IfMin::getCode(const Address &adr, int pc) {
   return "if (reg == 0) goto *a["+adr.getIntStr()+"];";
 }
@@ -261,23 +175,11 @@ void JumpReg::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram
   pc = adr.val;
 }
 
-vector<Address> JumpReg::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(NONE, FIRST_ADDRESS) };
-}
-
 Address JumpReg::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                             const Ram *ram) {
   return Address(CODE, Util::getSecondNibble(reg));
 }
 
-string JumpReg::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int JumpReg::getAdrIndex() {
-  return -1;
-}
-
 string JumpReg::getCode(const Address &adr, int pc) {
   return "goto *a[reg&"+to_string(RAM_SIZE)+"];";
 }
@@ -293,25 +195,15 @@ void ReadReg::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram
   increasePc(pc);
 }
 
-vector<Address> ReadReg::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(NONE, FIRST_ADDRESS) };
-}
-
 Address ReadReg::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                             const Ram *ram) {
   return Address(DATA, Util::getSecondNibble(reg));
 }
 
-string ReadReg::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int ReadReg::getAdrIndex() {
-  return -1;
-}
-
 string ReadReg::getCode(const Address &adr, int pc) {
-  return "reg = data[reg&"+to_string(RAM_SIZE)+"];";
+  return "adr = reg&"+to_string(RAM_SIZE)+"; "
+         "if (adr == "+to_string(RAM_SIZE)+") reg = predecesor(); "
+         "else reg = data[adr];";
 }
 
 // INITIALIZE FIRST ADDRESS
@@ -328,25 +220,12 @@ void InitializeFirstAddress::exec(const Address &adr, vector<bool> &pc,
   increasePc(pc);
 }
 
-vector<Address> InitializeFirstAddress::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, FIRST_ADDRESS), 
-           Address(DATA, Util::getBoolNibb(INIT_OPERAND_INDEX)) };
-}
-
 Address InitializeFirstAddress::getAddress(Address &firstOrderAdr,
                                            const vector<bool> &reg,
                                            const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string InitializeFirstAddress::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int InitializeFirstAddress::getAdrIndex() {
-  return -1;
-}
-
 string InitializeFirstAddress::getCode(const Address &adr, int pc) {
   return "data[0] = data["+to_string(INIT_OPERAND_INDEX)+"]; reg = data[0];";
 }
@@ -361,23 +240,11 @@ void Not::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram
   increasePc(pc);
 }
 
-vector<Address> Not::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(NONE, FIRST_ADDRESS) };
-}
-
 Address Not::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                         const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Not::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int Not::getAdrIndex() {
-  return -1;
-}
-
 string Not::getCode(const Address &adr, int pc) {
   return "reg = ~reg;";
 }
@@ -392,23 +259,11 @@ void ShiftLeft::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   shift(pc, reg, 1);
 }
 
-vector<Address> ShiftLeft::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(NONE, FIRST_ADDRESS) };
-}
-
 Address ShiftLeft::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                               const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string ShiftLeft::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int ShiftLeft::getAdrIndex() {
-  return -1;
-}
-
 string ShiftLeft::getCode(const Address &adr, int pc) {
   return "reg <<= 1;";
 }
@@ -423,23 +278,11 @@ void ShiftRight::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   shift(pc, reg, -1);
 }
 
-vector<Address> ShiftRight::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(NONE, FIRST_ADDRESS) };
-}
-
 Address ShiftRight::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                                const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string ShiftRight::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int ShiftRight::getAdrIndex() {
-  return -1;
-}
-
 string ShiftRight::getCode(const Address &adr, int pc) {
   return "reg >>= 1;";
 }
@@ -454,23 +297,11 @@ void And::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram
   andOrOr(adr, pc, reg, ram, true);
 }
 
-vector<Address> And::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getBoolNibb(AND_OPERAND_INDEX)) };
-}
-
 Address And::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                         const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string And::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int And::getAdrIndex() {
-  return -1;
-}
-
 string And::getCode(const Address &adr, int pc) {
   return "reg &= data["+to_string(AND_OPERAND_INDEX)+"];";
 }
@@ -485,23 +316,11 @@ void Or::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram)
   andOrOr(adr, pc, reg, ram, false);
 }
 
-vector<Address> Or::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getBoolNibb(OR_OPERAND_INDEX)) };
-}
-
 Address Or::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                        const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Or::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int Or::getAdrIndex() {
-  return -1;
-}
-
 string Or::getCode(const Address &adr, int pc) {
   return "reg |= data["+to_string(OR_OPERAND_INDEX)+"];";
 }
@@ -518,23 +337,11 @@ void Xor::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &ram
   increasePc(pc);
 }
 
-vector<Address> Xor::getFirstOrderAdr(vector<bool> &val) {
-  return { getThreeBitAddress(val) };
-}
-
 Address Xor::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                         const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Xor::getLabel() {
-  return getLogicOpsIndicator();
-}
-
-int Xor::getAdrIndex() {
-  return 5;
-}
-
 string Xor::getCode(const Address &adr, int pc) {
   return "reg ^= "+getOperand(adr)+";";
 }
@@ -550,28 +357,16 @@ void ReadPointer::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   increasePc(pc);
 }
 
-vector<Address> ReadPointer::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address ReadPointer::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                                 const Ram *ram) {
   // If ram is NULL, then treat it as a empty ram.
   if (ram == NULL) {
-    Address(DATA, FIRST_ADDRESS);
+    return Address(DATA, FIRST_ADDRESS);
   }
   vector<bool> pointer = ram->get(firstOrderAdr);
   return Address(DATA, Util::getSecondNibble(pointer));
 }
 
-string ReadPointer::getLabel() {
-  return "READ *";
-}
-
-int ReadPointer::getAdrIndex() {
-  return 4;
-}
-
 string ReadPointer::getCode(const Address &adr, int pc) {
   return "adr = "+getOperand(adr)+"&"+to_string(RAM_SIZE)+"; "
          "if (adr == "+to_string(RAM_SIZE)+") reg = predecesor(); "
@@ -589,28 +384,16 @@ void WritePointer::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   increasePc(pc);
 }
 
-vector<Address> WritePointer::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address WritePointer::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                                  const Ram *ram) {
   // If ram is NULL, then treat it as a empty ram.
   if (ram == NULL) {
-    Address(DATA, FIRST_ADDRESS);
+    return Address(DATA, FIRST_ADDRESS);
   }
   vector<bool> pointer = ram->get(firstOrderAdr);
   return Address(DATA, Util::getSecondNibble(pointer));
 }
 
-string WritePointer::getLabel() {
-  return "WRITE *";
-}
-
-int WritePointer::getAdrIndex() {
-  return 4;
-}
-
 string WritePointer::getCode(const Address &adr, int pc) {
   return "pc = "+to_string(pc)+"; "
          "adr = "+getOperand(adr)+"&"+to_string(RAM_SIZE)+"; "
@@ -629,23 +412,11 @@ void Increase::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   incOrDec(adr, pc, reg, ram, true);
 }
 
-vector<Address> Increase::getFirstOrderAdr(vector<bool> &val) {
-  return { getThreeBitAddress(val) };
-}
-
 Address Increase::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                              const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Increase::getLabel() {
-  return "INC/DEC";
-}
-
-int Increase::getAdrIndex() {
-  return 5;
-}
-
 string Increase::getCode(const Address &adr, int pc) {
   return "data["+adr.getIntStr()+"]++; "
          "reg = data["+adr.getIntStr()+"];";
@@ -662,23 +433,11 @@ void Decrease::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   incOrDec(adr, pc, reg, ram, false);
 }
 
-vector<Address> Decrease::getFirstOrderAdr(vector<bool> &val) {
-  return { getThreeBitAddress(val) };
-}
-
 Address Decrease::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                              const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Decrease::getLabel() {
-  return "INC/DEC";
-}
-
-int Decrease::getAdrIndex() {
-  return 5;
-}
-
 string Decrease::getCode(const Address &adr, int pc) {
   return "data["+adr.getIntStr()+"]--; "
          "reg = data["+adr.getIntStr()+"];";
@@ -696,23 +455,11 @@ void Print::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg, Ram &r
   increasePc(pc);
 }
 
-vector<Address> Print::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(DATA, Util::getSecondNibble(val)) };
-}
-
 Address Print::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                           const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string Print::getLabel() {
-  return "PRINT";
-}
-
-int Print::getAdrIndex() {
-  return 4;
-}
-
 string Print::getCode(const Address &adr, int pc) {
   return "pc = "+to_string(pc)+"; "
          "return "+getOperand(adr)+";";
@@ -732,23 +479,11 @@ void IfNotMax::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   }
 }
 
-vector<Address> IfNotMax::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(CODE, Util::getSecondNibble(val)) };
-}
-
 Address IfNotMax::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                              const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string IfNotMax::getLabel() {
-  return "IF NOT MAX";
-}
-
-int IfNotMax::getAdrIndex() {
-  return 4;
-}
-
 string IfNotMax::getCode(const Address &adr, int pc) {
   return "if (reg != "+to_string(MAX_VALUE)+") goto *a["+adr.getIntStr()+"];";
 }
@@ -767,23 +502,11 @@ void IfNotMin::exec(const Address &adr, vector<bool> &pc, vector<bool> &reg,
   }
 }
 
-vector<Address> IfNotMin::getFirstOrderAdr(vector<bool> &val) {
-  return { Address(CODE, Util::getSecondNibble(val)) };
-}
-
 Address IfNotMin::getAddress(Address &firstOrderAdr, const vector<bool> &reg,
                              const Ram *ram) {
   return firstOrderAdr;  
 }
 
-string IfNotMin::getLabel() {
-  return "IF NOT MIN";
-}
-
-int IfNotMin::getAdrIndex() {
-  return 4;
-}
-
 string IfNotMin::getCode(const Address &adr, int pc) {
   return "if (reg != 0) goto *a["+adr.getIntStr()+"];";
 }
@@ -792,20 +515,10 @@ string IfNotMin::getCode(const Address &adr, int pc) {
 // UTIL //
 //////////
 
-string getLogicOpsIndicator() {
-  return "JRI~<>&VX";
-}
-
 void increasePc(vector<bool> &pc) {
   pc = Util::getBoolNibb(Util::getInt(pc) + 1);
 }
 
-Address getThreeBitAddress(const vector<bool> &val) {
-  vector<bool> adr = Util::getSecondNibble(val);
-  adr[0] = false;
-  return Address(DATA, adr);
-}
-
 /*
  * Adds or subtracts value at passed address from register,
  * and stores result in the register.
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <vector>
 
+#include "startup_stats.hpp"
 #include "util.hpp"
 
 using namespace std;
@@ -27,5 +28,6 @@ void StandardOutput::printBool(vector<bool> wordIn) {
   } else {
     cout << Util::getString(wordIn) + "\n";
   }
+  StartupStats::markFirstOutput();
 }
 
@@ -0,0 +1,39 @@
+#include "startup_stats.hpp"
+
+#include <stdio.h>
+#include <time.h>
+
+using namespace std;
+
+double StartupStats::firstInstruction = -1;
+double StartupStats::firstOutput = -1;
+
+void StartupStats::markFirstInstruction() {
+  if (firstInstruction < 0) {
+    firstInstruction = getCpuTime();
+  }
+}
+
+void StartupStats::markFirstOutput() {
+  if (firstOutput < 0) {
+    firstOutput = getCpuTime();
+  }
+}
+
+void StartupStats::printStats() {
+  const char *labels[] = { "first instruction", "first output" };
+  double times[] = { firstInstruction, firstOutput };
+  for (int i = 0; i < 2; i++) {
+    if (times[i] < 0) {
+      fprintf(stderr, "%-20s-\n", labels[i]);
+    } else {
+      fprintf(stderr, "%-20s%.3f ms\n", labels[i], times[i]);
+    }
+  }
+}
+
+double StartupStats::getCpuTime() {
+  struct timespec time;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+  return time.tv_sec * 1e3 + time.tv_nsec / 1e6;
+}
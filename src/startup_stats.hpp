@@ -0,0 +1,25 @@
+#ifndef STARTUP_STATS_H
+#define STARTUP_STATS_H
+
+using namespace std;
+
+/*
+ * Cpu time that the process used until the first instruction got executed
+ * and until the first word got printed. It is measured from the start of
+ * the process, so it includes loading and static initialization, but not
+ * the time spent waiting for the input.
+ */
+class StartupStats {
+  public:
+    static void markFirstInstruction();
+    static void markFirstOutput();
+    static void printStats();
+
+  private:
+    // In milliseconds, or negative if it didn't happen yet.
+    static double firstInstruction;
+    static double firstOutput;
+    static double getCpuTime();
+};
+
+#endif
@@ -0,0 +1,110 @@
+#include "tiered_computer.hpp"
+
+#include <stdlib.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "const.hpp"
+#include "native_stage.hpp"
+#include "parser.hpp"
+#include "partial_evaluator.hpp"
+#include "startup_stats.hpp"
+#include "util.hpp"
+
+using namespace std;
+
+/*
+ * Once the program leaves the reference cpu, its state lives in the fast
+ * cpu, and native code continues from there when it gets compiled.
+ */
+vector<bool> TieredComputer::getOutput() {
+  if (precomputedIndex < precomputedOutput.size()) {
+    return precomputedOutput[precomputedIndex++];
+  }
+  switch (tier) {
+    case REFERENCE:
+      return runReference();
+    case FAST:
+      return runFast();
+    default:
+      return runNative();
+  }
+}
+
+/*
+ * Runs the program until it tries to read from the input, and saves its
+ * output, so it can be returned without executing those cycles again.
+ */
+void TieredComputer::evaluateUntilInput() {
+  StartupStats::markFirstInstruction();
+  if (Debugger::enabled()) {
+    return;
+  }
+  precomputedOutput = PartialEvaluator::evaluate(computer.ram, computer.cpu);
+  precomputedIndex = 0;
+}
+
+/*
+ * Name identifies the computer in the messages of the debugger.
+ */
+void TieredComputer::setName(const string &name) {
+  debugger.setName(name);
+}
+
+vector<bool> TieredComputer::runReference() {
+  Ram &ram = computer.ram;
+  Cpu &cpu = computer.cpu;
+  while (cpu.getCycle() < FAST_TIER_CYCLES && !Debugger::enabled()) {
+    bool shouldContinue = cpu.step();
+    if (ram.outputPending) {
+      ram.outputPending = false;
+      return ram.output;
+    }
+    if (!shouldContinue) {
+      exit(0);
+    }
+  }
+  fastCpu.load(ram, cpu);
+  if (Debugger::enabled()) {
+    fastCpu.debugger = &debugger;
+  }
+  tier = FAST;
+  return runFast();
+}
+
+/*
+ * Runs in slices, so that native code can also take over from a program
+ * that doesn't produce any output for a long time.
+ */
+vector<bool> TieredComputer::runFast() {
+  while (true) {
+    bool compile = fastCpu.cycle >= NATIVE_TIER_CYCLES &&
+                   !Debugger::enabled();
+    if (!nativeStage && compile) {
+      string source = Parser::getNativeStage(computer.ram);
+      nativeStage = NativeStage::compileInBackground(source);
+    }
+    if (nativeStage && nativeStage->isReady()) {
+      tier = NATIVE;
+      return runNative();
+    }
+    int out = fastCpu.run(FAST_TIER_SLICE);
+    if (out == FastCpu::END) {
+      exit(0);
+    }
+    if (out != FastCpu::PAUSED) {
+      return Util::getBoolByte(out);
+    }
+  }
+}
+
+vector<bool> TieredComputer::runNative() {
+  int out = nativeStage->run(fastCpu.input, fastCpu.data, fastCpu.reg,
+                             fastCpu.pc);
+  if (out == NativeStage::END) {
+    exit(0);
+  }
+  return Util::getBoolByte(out);
+}
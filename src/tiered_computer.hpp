@@ -0,0 +1,48 @@
+#ifndef TIERED_COMPUTER_H
+#define TIERED_COMPUTER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "computer.hpp"
+#include "debugger.hpp"
+#include "fast_cpu.hpp"
+#include "native_stage.hpp"
+#include "provides_output.hpp"
+
+using namespace std;
+
+/*
+ * Execution manager for one computer of the chain in non-interactive mode.
+ * Program starts on the reference cpu. If it keeps running, it gets moved
+ * to the fast cpu, and if it keeps running even longer, it gets compiled to
+ * native code in the background, that takes over at the next output.
+ * If there are any breakpoints, program runs on the fast cpu from the start,
+ * and never gets compiled, so all the cycles get checked.
+ */
+class TieredComputer : public ProvidesOutput {
+  public:
+    vector<bool> getOutput();
+    void evaluateUntilInput();
+    void setName(const string &name);
+
+    // Reference computer that holds the initial state.
+    Computer computer;
+
+  private:
+    enum Tier { REFERENCE, FAST, NATIVE };
+    Tier tier = REFERENCE;
+    FastCpu fastCpu;
+    Debugger debugger;
+    shared_ptr<NativeStage> nativeStage;
+    // Output of the partially evaluated part of the program.
+    vector<vector<bool>> precomputedOutput;
+    size_t precomputedIndex = 0;
+
+    vector<bool> runReference();
+    vector<bool> runFast();
+    vector<bool> runNative();
+};
+
+#endif
@@ -4,7 +4,6 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/select.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -20,7 +19,7 @@
 
 using namespace std;
 
-int Util::getInt(vector<bool> bbb) {
+int Util::getInt(const vector<bool> &bbb) {
   int sum = 0;
   int power = 1;
   for (int i = bbb.size()-1; i >= 0; i--, power *= 2) {
@@ -146,19 +145,28 @@ vector<bool> Util::readWordFromPipe() {
  * GENERAL UTIL
  */
 
-vector<vector<string>> Util::splitIntoLines(vector<string> drawing) {
+/*
+ * Splits UTF-8 text into lines of characters. Characters after the last
+ * new line are ignored.
+ */
+vector<vector<string>> Util::splitIntoLines(const char *text) {
   vector<vector<string>> out;
   vector<string> line;
-  for (string c : drawing) {
-    if (c == u8"\u000A" /*NEW_LINE_SECOND*/) {
-      continue;
-    }
-    if (c == u8"\u000D" /*NEW_LINE_FIRST*/) {
+  const char *c = text;
+  while (*c) {
+    if (*c == '\n') {
       out.push_back(line);
       line = {};
+      c++;
       continue;
     }
-    line.push_back(c);
+    size_t length = 1;
+    // Continuation bytes of a multi-byte character start with '10'.
+    while ((c[length] & 0xC0) == 0x80) {
+      length++;
+    }
+    line.push_back(string(c, length));
+    c += length;
   }
   return out;
 } 
@@ -238,22 +246,6 @@ tuple<int, int> Util::getCoordinatesOfFirstOccurance(vector<string> text,
   exit(1);
 }
 
-/*
- * Returns the code of last pressed key, or 0 if none was pressed.
- */
-int Util::getKey() {
-  int c = 0;
-  struct timeval tv = { 0L, 0L };
-  fd_set fds;
-  FD_ZERO(&fds);
-  FD_SET(STDIN_FILENO, &fds);
-  select(STDIN_FILENO + 1, &fds, NULL, NULL, &tv);
-  if (FD_ISSET(STDIN_FILENO, &fds)) {
-    c = getchar();
-  }
-  return c;
-}
-
 bool Util::fileExists(string filename) {
     struct stat buf;
     if (stat(filename.c_str(), &buf) != -1) {
@@ -338,14 +330,6 @@ vector<bool> Util::bitwiseNot(vector<bool> val) {
   return val;
 }
 
-vector<string> Util::stringToVecOfString(string stringIn) {
-  vector<string> out;
-  for (char c : stringIn) {
-    out.push_back(string(1, c));
-  }
-  return out;
-}
-
 size_t Util::getSizeOfLargestElement(vector<vector<string>> lines) {
   size_t maxSize = 0;
   for (vector<string> line : lines) {
@@ -9,7 +9,7 @@ using namespace std;
 
 class Util {
   public:
-    static int getInt(vector<bool> bbb);
+    static int getInt(const vector<bool> &bbb);
     static vector<bool> getBoolByte(int num);
     static vector<bool> getBoolNibb(int num);
     static vector<bool> getBool(int num, int length);
@@ -25,7 +25,7 @@ class Util {
     static vector<bool> parseWord(string word);
     static vector<bool> readWordFromPipe();
     // UNICODE
-    static vector<vector<string>> splitIntoLines(vector<string> drawing);
+    static vector<vector<string>> splitIntoLines(const char *text);
     // STRING
     static vector<string> splitString(string stringIn);
     static string makeString(vector<string> lines);
@@ -33,7 +33,6 @@ class Util {
     static string getString(char cIn);
     static tuple<int,int> getCoordinatesOfFirstOccurance(vector<string> text,
                                                          string cIn);
-    static int getKey();
     static bool fileExists(string filename);
     static bool inputIsPiped();
     static bool outputIsPiped();
@@ -46,7 +45,6 @@ class Util {
                                        bool isAnd);
     static vector<bool> bitwiseXor(vector<bool> value1, vector<bool> value2);
     static vector<bool> bitwiseNot(vector<bool> val);
-    static vector<string> stringToVecOfString(string stringIn);
     static size_t getSizeOfLargestElement(vector<vector<string>> lines);
     static vector<string> getFilesInDirectory(const string &directory);
     static bool endsWith(string const &fullString, string const &ending);
@@ -1,24 +1,120 @@
 #include "view.hpp"
 
+#include "const.hpp"
+#include "decode_table.hpp"
 #include "util.hpp"
 
+#include <algorithm>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
-View::View(vector<string> drawingIn, string lightBulbOnIn, string lightBulbOffIn) {
-  lines = Util::splitIntoLines(drawingIn);
+View::View(const Drawing &drawingIn, string lightBulbOnIn,
+           string lightBulbOffIn)
+    : drawing(drawingIn) {
   lightBulbOn = lightBulbOnIn;
   lightBulbOff = lightBulbOffIn;
-  height = lines.size();
-  width = Util::getSizeOfLargestElement(lines);
+  height = drawingIn.height;
+  width = drawingIn.width;
+}
+
+const vector<vector<Glyph>> &View::getLines() const {
+  internLines();
+  return lines;
 }
 
 /*
  * Returns the character that represents lightbulb, either on or off.
  */
-string View::getLightbulb(bool value) const {
+Glyph View::getLightbulb(bool value) const {
+  internLines();
   if (value) {
-    return lightBulbOn;
+    return lightBulbOnGlyph;
   } else {
-    return lightBulbOff;
+    return lightBulbOffGlyph;
+  }
+}
+
+const vector<Position> &View::getSlots(const string &indicator) const {
+  return getSlots(GlyphTable::getGlyph(indicator));
+}
+
+const vector<Position> &View::getSlots(Glyph indicator) const {
+  buildIndex();
+  return slots[indicator];
+}
+
+const vector<Position> &View::getLabelPositions(const string &label) const {
+  buildIndex();
+  return labelPositions[label];
+}
+
+/*
+ * Label of the instruction as it appears in the drawing.
+ */
+string View::getOperatorLabel(const string &label) {
+  string out = " " + label;
+  out.append(11 - label.length(), ' ');
+  return out;
+}
+
+/*
+ * Finds all the characters that change between frames, so renderer doesn't
+ * need to scan the whole drawing. It doesn't happen in constructor, because
+ * views are global and constants from 'const.hpp' might not be initialized
+ * at that time.
+ */
+void View::buildIndex() const {
+  if (indexed) {
+    return;
+  }
+  indexed = true;
+  set<string> labels = { LAST_CODE_ADDR_LABEL, LAST_DATA_ADDR_LABEL };
+  for (const DecodedInstruction &inst : DECODE_TABLE) {
+    labels.insert(getOperatorLabel(inst.label));
+  }
+  set<Glyph> slotGlyphs = { GlyphTable::getGlyph(OUTPUT_INDICATOR),
+                            GlyphTable::getGlyph(CODE_HEAT_INDICATOR),
+                            GlyphTable::getGlyph(DATA_HEAT_INDICATOR) };
+  for (const string &indicator : LIGHTBULB_INDICATORS) {
+    slotGlyphs.insert(GlyphTable::getGlyph(indicator));
+  }
+  map<string, vector<Glyph>> labelGlyphs;
+  for (const string &label : labels) {
+    for (char c : label) {
+      labelGlyphs[label].push_back(GlyphTable::getGlyph(c));
+    }
+  }
+  for (size_t y = 0; y < getLines().size(); y++) {
+    const vector<Glyph> &line = lines[y];
+    for (size_t x = 0; x < line.size(); x++) {
+      if (slotGlyphs.count(line[x])) {
+        slots[line[x]].push_back({ (int) y, (int) x });
+      }
+    }
+    for (const string &label : labels) {
+      const vector<Glyph> &labelVec = labelGlyphs[label];
+      auto it = search(line.begin(), line.end(), labelVec.begin(),
+                       labelVec.end());
+      if (it != line.end()) {
+        labelPositions[label].push_back({ (int) y, (int) (it - line.begin()) });
+      }
+    }
+  }
+}
+
+void View::internLines() const {
+  if (!lines.empty()) {
+    return;
+  }
+  for (const vector<string> &line : Util::splitIntoLines(drawing.text)) {
+    vector<Glyph> glyphs;
+    for (const string &character : line) {
+      glyphs.push_back(GlyphTable::getGlyph(character));
+    }
+    lines.push_back(glyphs);
   }
+  lightBulbOnGlyph = GlyphTable::getGlyph(lightBulbOn);
+  lightBulbOffGlyph = GlyphTable::getGlyph(lightBulbOff);
 }
\ No newline at end of file
@@ -1,25 +1,67 @@
 #ifndef VIEW_H
 #define VIEW_H
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "glyph.hpp"
+
 using namespace std;
 
+/*
+ * Drawing as it gets generated from the textfile by 'tools/parseDrawing',
+ * with lines packed into a single UTF-8 string, each ending with a new
+ * line. It's a constant, so it doesn't need to be built at startup.
+ */
+struct Drawing {
+  size_t height;
+  size_t width;
+  const char *text;
+};
+
+/*
+ * Location of a character in the drawing.
+ */
+struct Position {
+  int y;
+  int x;
+};
+
 class View {
   public:
-    vector<vector<string>> lines;
     string lightBulbOn;
     string lightBulbOff;
     size_t height;
     size_t width;
-    View(vector<string> drawingIn, string lightBulbOnIn, string lightBulbOffIn);
-    string getLightbulb(bool value) const;
+    View(const Drawing &drawingIn, string lightBulbOnIn,
+         string lightBulbOffIn);
+    const vector<vector<Glyph>> &getLines() const;
+    Glyph getLightbulb(bool value) const;
+    const vector<Position> &getSlots(const string &indicator) const;
+    const vector<Position> &getSlots(Glyph indicator) const;
+    const vector<Position> &getLabelPositions(const string &label) const;
+    static string getOperatorLabel(const string &label);
     bool operator == (const View& v) const {
-      return lines == v.lines && 
+      return drawing.text == v.drawing.text && 
              lightBulbOn == v.lightBulbOn && 
              lightBulbOff == v.lightBulbOff;
     }
+
+  private:
+    const Drawing &drawing;
+    // Lines split into interned characters, and interned lightbulbs. They
+    // are only built when view gets used for the first time.
+    mutable vector<vector<Glyph>> lines;
+    mutable Glyph lightBulbOnGlyph;
+    mutable Glyph lightBulbOffGlyph;
+    // Positions of lightbulb, output and heat indicators, in the order of
+    // occurance, and positions of labels, first occurance in each line.
+    mutable map<Glyph, vector<Position>> slots;
+    mutable map<string, vector<Position>> labelPositions;
+    mutable bool indexed = false;
+    void buildIndex() const;
+    void internLines() const;
 };
 
 #endif
\ No newline at end of file